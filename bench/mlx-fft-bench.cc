@@ -0,0 +1,362 @@
+/**
+ * @file    mlx-fft-bench.cc
+ * @brief   Speed and Accuracy of the Real FFT Backends against GSL
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ *  Usage: mlx_fft_bench [native | bluestein | float | all] [max. Length]
+ *
+ *      native      Powers of Two 8 ... 2^20: GSL mixed-radix vs. native Stockham FFT
+ *      bluestein   Lengths 1000 ... 100000 (Grid, next Prime, 5-smooth): GSL vs. Bluestein
+ *                  vs. AUTO, worst Case per N log2(N) and fitted MLX_FFT_BLUESTEIN_WEIGHT
+ *      float       Backends in double vs. float (MlxRealFFTBackendFloat), Time, Table
+ *                  Size and Deviation of the float Spectrum
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "mlx-fft-backend.h"
+
+
+namespace
+{
+    using namespace mlx;
+
+    /* Minimum measured Time per Run and Number of Runs (best one counts) */
+    static const double MLX_BENCH_MIN_SECONDS = 0.05;
+    static const size_t MLX_BENCH_RUNS = 3;
+
+    /* Longest Length checked against the O(N^2) long double Reference */
+    static const size_t MLX_BENCH_REFERENCE_LENGTH = 4096;
+
+    /* Grid of the Bluestein Sweep: Points per Decade from 1000 to 100000 */
+    static const size_t MLX_BENCH_SWEEP_POINTS = 8;
+
+
+    std::vector<double> _signal(size_t length)
+    {
+        std::mt19937_64 rng(length);
+        std::normal_distribution<double> normal;
+
+        std::vector<double> res(length);
+        for (double &x : res) x = normal(rng);
+
+        return res;
+    }
+
+
+    /* ns per Transform, best of MLX_BENCH_RUNS */
+    template <typename T>
+    double _time(const MlxBasicRealFFTBackend<T> &backend, const std::vector<T> &signal)
+    {
+        std::unique_ptr<typename MlxBasicRealFFTBackend<T>::Workspace> ws = backend.createWorkspace();
+        std::vector<T> data(signal);
+
+        size_t reps = 1;
+        double best = INFINITY;
+
+        for (size_t run = 0; run < MLX_BENCH_RUNS; run++)
+        {
+            while (true)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+
+                for (size_t r = 0; r < reps; r++)
+                {
+                    std::copy(signal.begin(), signal.end(), data.begin());
+                    backend.transform(data.data(), *ws);
+                }
+
+                const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+                if (sec >= MLX_BENCH_MIN_SECONDS)
+                {
+                    best = std::min(best, (1e9 * sec) / reps);
+                    break;
+                }
+
+                reps *= 2;
+            }
+        }
+
+        return best;
+    }
+
+
+    template <typename T>
+    std::vector<T> _transform(const MlxBasicRealFFTBackend<T> &backend, const std::vector<T> &signal)
+    {
+        std::unique_ptr<typename MlxBasicRealFFTBackend<T>::Workspace> ws = backend.createWorkspace();
+        std::vector<T> res(signal);
+
+        backend.transform(res.data(), *ws);
+        return res;
+    }
+
+
+    /* long double DFT in Half Complex Layout */
+    std::vector<double> _reference(const std::vector<double> &signal)
+    {
+        const size_t N = signal.size();
+        std::vector<double> res(N);
+
+        for (size_t k = 0; (2 * k) <= N; k++)
+        {
+            long double re = 0.0L, im = 0.0L;
+
+            for (size_t n = 0; n < N; n++)
+            {
+                const long double a = (-2.0L * M_PIl * ((k * n) % N)) / N;
+                re += signal[n] * cosl(a);
+                im += signal[n] * sinl(a);
+            }
+
+            if (k == 0) res[0] = double(re);
+            else res[(2 * k) - 1] = double(re);
+
+            if ((k > 0) && ((2 * k) < N)) res[2 * k] = double(im);
+        }
+
+        return res;
+    }
+
+
+    /* max |a - b| / max |b| */
+    double _error(const std::vector<double> &a, const std::vector<double> &b)
+    {
+        double diff = 0.0, scale = 0.0;
+
+        for (size_t k = 0; k < a.size(); k++)
+        {
+            diff = std::max(diff, fabs(a[k] - b[k]));
+            scale = std::max(scale, fabs(b[k]));
+        }
+
+        return (scale > 0.0) ? (diff / scale) : diff;
+    }
+
+
+    /* max |inverse(transform(x)) - x| / max |x| */
+    double _roundtrip(const MlxRealFFTBackend &backend, const std::vector<double> &signal)
+    {
+        std::unique_ptr<MlxRealFFTBackend::Workspace> ws = backend.createWorkspace();
+        std::vector<double> data(signal);
+
+        backend.transform(data.data(), *ws);
+        backend.inverse(data.data(), *ws);
+
+        return _error(data, signal);
+    }
+
+
+    void _native(size_t maxLength)
+    {
+        printf("# Powers of Two: GSL mixed-radix vs. native (AVX2 / FMA if available)\n");
+        printf("# Errors: max abs. Deviation / max |X|, against a long double DFT up to N = %zu\n", MLX_BENCH_REFERENCE_LENGTH);
+        printf("%8s %12s %12s %8s %10s %10s %10s %10s\n", "N", "gsl[ns]", "native[ns]", "speedup", "err(gsl)", "err(nat)", "nat-gsl", "roundtrip");
+
+        for (size_t N = 8; N <= std::min(maxLength, size_t(1) << 20); N *= 2)
+        {
+            const std::vector<double> signal = _signal(N);
+
+            std::shared_ptr<const MlxRealFFTBackend> gsl = MlxRealFFTBackend::create(N, MLX_FFT_BACKEND_GSL);
+            std::shared_ptr<const MlxRealFFTBackend> native = MlxRealFFTBackend::create(N, MLX_FFT_BACKEND_NATIVE);
+
+            const double tg = _time(*gsl, signal);
+            const double tn = _time(*native, signal);
+
+            const std::vector<double> xg = _transform(*gsl, signal);
+            const std::vector<double> xn = _transform(*native, signal);
+
+            char eg[16] = "-", en[16] = "-";
+
+            if (N <= MLX_BENCH_REFERENCE_LENGTH)
+            {
+                const std::vector<double> ref = _reference(signal);
+                snprintf(eg, sizeof(eg), "%.2e", _error(xg, ref));
+                snprintf(en, sizeof(en), "%.2e", _error(xn, ref));
+            }
+
+            printf("%8zu %12.0f %12.0f %8.2f %10s %10s %10.2e %10.2e\n", N, tg, tn, tg / tn, eg, en, _error(xn, xg), _roundtrip(*native, signal));
+        }
+
+        printf("\n");
+    }
+
+
+    size_t _nextPrime(size_t n)
+    {
+        for (;; n++)
+        {
+            bool prime = (n >= 2);
+
+            for (size_t p = 2; prime && ((p * p) <= n); p++)
+            {
+                prime = ((n % p) != 0);
+            }
+
+            if (prime) return n;
+        }
+    }
+
+
+    size_t _largestFactor(size_t n)
+    {
+        size_t res = 1;
+
+        for (size_t p = 2; (p * p) <= n; p++)
+        {
+            while ((n % p) == 0)
+            {
+                res = p;
+                n /= p;
+            }
+        }
+
+        return std::max(res, n);
+    }
+
+
+    double _median(std::vector<double> values)
+    {
+        if (values.empty()) return 0.0;
+
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+
+
+    void _bluestein(size_t maxLength)
+    {
+        std::vector<size_t> lengths;
+
+        for (size_t j = 0; j <= (2 * MLX_BENCH_SWEEP_POINTS); j++)
+        {
+            const size_t g = size_t(llround(1000.0 * pow(10.0, double(j) / MLX_BENCH_SWEEP_POINTS)));
+
+            lengths.push_back(g);
+            lengths.push_back(_nextPrime(g));
+            lengths.push_back(fftFastLength(g));
+        }
+
+        std::sort(lengths.begin(), lengths.end());
+        lengths.erase(std::unique(lengths.begin(), lengths.end()), lengths.end());
+
+        printf("# Awkward Lengths: GSL mixed-radix vs. Bluestein, AUTO = MlxRealFFTBackend::select (Weight %.2f)\n", MLX_FFT_BLUESTEIN_WEIGHT);
+        printf("# Times in ns, Columns /NlogN in ns per N log2(N)\n");
+        printf("%8s %8s %12s %12s %10s %10s %10s %10s %10s\n", "N", "maxp", "gsl[ns]", "blue[ns]", "auto", "gsl/NlogN", "auto/NlogN", "err(blue)", "roundtrip");
+
+        std::vector<double> gslUnit, blueUnit;
+        double worstGsl = 0.0, worstAuto = 0.0;
+        size_t wrong = 0, count = 0;
+
+        for (size_t N : lengths)
+        {
+            if (N > maxLength) break;
+
+            const std::vector<double> signal = _signal(N);
+
+            std::shared_ptr<const MlxRealFFTBackend> gsl = MlxRealFFTBackend::create(N, MLX_FFT_BACKEND_GSL);
+            std::shared_ptr<const MlxRealFFTBackend> blue = MlxRealFFTBackend::create(N, MLX_FFT_BACKEND_BLUESTEIN);
+
+            const double tg = _time(*gsl, signal);
+            const double tb = _time(*blue, signal);
+
+            const FFTBackend_t chosen = MlxRealFFTBackend::select(N);
+            const double ta = (chosen == MLX_FFT_BACKEND_BLUESTEIN) ? tb : tg;
+            const double nlogn = N * log2(double(N));
+
+            // ns per Cost Unit of either Model, their Ratio is the Weight
+            gslUnit.push_back(tg / MlxRealFFTBackend::gslCost(N));
+            blueUnit.push_back(tb / MlxRealFFTBackend::bluesteinCost(N));
+
+            worstGsl = std::max(worstGsl, tg / nlogn);
+            worstAuto = std::max(worstAuto, ta / nlogn);
+
+            if (ta > std::min(tg, tb)) wrong++;
+            count++;
+
+            printf("%8zu %8zu %12.0f %12.0f %10s %10.3f %10.3f %10.2e %10.2e\n", N, _largestFactor(N), tg, tb,
+                (chosen == MLX_FFT_BACKEND_BLUESTEIN) ? "bluestein" : "gsl", tg / nlogn, ta / nlogn,
+                _error(_transform(*blue, signal), _transform(*gsl, signal)), _roundtrip(*blue, signal));
+        }
+
+        if (count == 0) return;
+
+        printf("# worst Case per N log2(N): GSL %.3f ns, AUTO %.3f ns (%.1fx flatter)\n", worstGsl, worstAuto, worstGsl / worstAuto);
+        printf("# AUTO picked the slower Backend for %zu of %zu Lengths\n", wrong, count);
+        printf("# fitted MLX_FFT_BLUESTEIN_WEIGHT = median(blue / bluesteinCost) / median(gsl / gslCost) = %.2f\n\n",
+            _median(blueUnit) / _median(gslUnit));
+    }
+
+
+    void _float(size_t maxLength)
+    {
+        std::vector<size_t> lengths;
+
+        for (size_t N = 64; N <= std::min(maxLength, size_t(1) << 20); N *= 4) lengths.push_back(N);
+        for (size_t N = 1000; N <= std::min(maxLength, size_t(100000)); N *= 10) lengths.push_back(_nextPrime(N));
+
+        printf("# double vs. float Backends (AUTO): Powers of Two native, Primes Bluestein\n");
+        printf("# err: max |X(float) - X(double)| / max |X(double)|, roundtrip of the float Backend\n");
+        printf("%8s %10s %12s %12s %8s %10s %10s %10s %10s\n", "N", "backend", "double[ns]", "float[ns]", "speedup", "kB(d)", "kB(f)", "err", "roundtrip");
+
+        for (size_t N : lengths)
+        {
+            const std::vector<double> signal = _signal(N);
+            const std::vector<float> signalF(signal.begin(), signal.end());
+
+            std::shared_ptr<const MlxRealFFTBackend> bd = MlxRealFFTBackend::create(N);
+            std::shared_ptr<const MlxRealFFTBackendFloat> bf = MlxRealFFTBackendFloat::create(N);
+
+            const double td = _time(*bd, signal);
+            const double tf = _time(*bf, signalF);
+
+            const std::vector<double> xd = _transform(*bd, signal);
+            const std::vector<float> xf = _transform(*bf, signalF);
+
+            std::unique_ptr<MlxRealFFTBackendFloat::Workspace> ws = bf->createWorkspace();
+            std::vector<float> rt(xf);
+            bf->inverse(rt.data(), *ws);
+
+            printf("%8zu %10s %12.0f %12.0f %8.2f %10.1f %10.1f %10.2e %10.2e\n", N, (bd->type() == MLX_FFT_BACKEND_NATIVE) ? "native" : "bluestein",
+                td, tf, td / tf, bd->bytes() / 1024.0, bf->bytes() / 1024.0,
+                _error(std::vector<double>(xf.begin(), xf.end()), xd), _error(std::vector<double>(rt.begin(), rt.end()), signal));
+        }
+
+        printf("\n");
+    }
+
+}   /* anonymous namespace */
+
+
+
+int main(int argc, char **argv)
+{
+    const char *mode = (argc > 1) ? argv[1] : "all";
+    const size_t maxLength = (argc > 2) ? size_t(strtoull(argv[2], nullptr, 10)) : SIZE_MAX;
+    const bool all = (strcmp(mode, "all") == 0);
+
+    if (all || (strcmp(mode, "native") == 0)) _native(maxLength);
+    if (all || (strcmp(mode, "bluestein") == 0)) _bluestein(maxLength);
+    if (all || (strcmp(mode, "float") == 0)) _float(maxLength);
+
+    return 0;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file    mlx-sos-bench.cc
+ * @brief   Block vs. per-Sample Filtering of SOS Cascades, static vs. dynamic Presets
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ *  Usage: mlx_sos_bench [Block Length]
+ *
+ *      Butterworth Low-Passes of 1 ... 32 Stages, MlxSOSFilter::filter(double) per Sample
+ *      vs. MlxSOSFilter::filter(in, out, n) over Blocks of the given Length (default 4096)
+ *
+ *      Presets MLX_SOS_BUTTERWORTH_10P, MLX_SOS_BESSEL_05P and MLX_SOS_BESSEL_10P as
+ *      MlxStaticSOSFilter vs. the dynamic MlxSOSFilter of MlxSOSFilterFactory, per Sample
+ *      and per Block, with the max. Deviation of the static from the dynamic Output
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include "mlx-sos-filter.h"
+#include "mlx-static-sos-filter.h"
+
+
+namespace
+{
+    using namespace mlx;
+
+    /* Minimum measured Time per Run and Number of Runs (best one counts) */
+    static const double MLX_BENCH_MIN_SECONDS = 0.05;
+    static const size_t MLX_BENCH_RUNS = 3;
+
+    /* Default Block Length */
+    static const size_t MLX_BENCH_BLOCK = 4096;
+
+
+    std::vector<double> _signal(size_t length)
+    {
+        std::mt19937_64 rng(length);
+        std::normal_distribution<double> normal;
+
+        std::vector<double> res(length);
+        for (double &x : res) x = normal(rng);
+
+        return res;
+    }
+
+
+    /* ns per Call of run, best of MLX_BENCH_RUNS */
+    double _time(const std::function<void()> &run)
+    {
+        size_t reps = 1;
+        double best = INFINITY;
+
+        for (size_t r = 0; r < MLX_BENCH_RUNS; r++)
+        {
+            while (true)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+
+                for (size_t i = 0; i < reps; i++) run();
+
+                const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+                if (sec >= MLX_BENCH_MIN_SECONDS)
+                {
+                    best = std::min(best, (1e9 * sec) / reps);
+                    break;
+                }
+
+                reps *= 2;
+            }
+        }
+
+        return best;
+    }
+
+
+    void _cascades(size_t block)
+    {
+        const std::vector<double> signal = _signal(block);
+        std::vector<double> a(block), b(block);
+
+        printf("# Butterworth Low-Pass fc = 0.1 fs, Blocks of %zu Samples, Times in ns per Sample\n", block);
+        printf("%8s %12s %12s %8s %12s %10s\n", "stages", "sample[ns]", "block[ns]", "speedup", "ns/stage", "max|diff|");
+
+        for (size_t S : {1, 2, 4, 7, 8, 12, 16, 17, 24, 32})
+        {
+            std::shared_ptr<MlxSOSFilter> sample = MlxSOSFilterFactory::getFilter(MLX_IIR_BUTTERWORTH, MLX_IIR_LOWPASS, 2 * S, 1.0, 0.1);
+            std::shared_ptr<MlxSOSFilter> blocked = MlxSOSFilterFactory::getFilter(MLX_IIR_BUTTERWORTH, MLX_IIR_LOWPASS, 2 * S, 1.0, 0.1);
+
+            if ((sample->stages() != S) || (blocked->stages() != S))
+            {
+                printf("%8zu %12s\n", S, "no design");
+                continue;
+            }
+
+            // same Output from the same State
+            for (size_t k = 0; k < block; k++) a[k] = sample->filter(signal[k]);
+            blocked->filter(signal.data(), b.data(), block);
+
+            double diff = 0.0;
+            for (size_t k = 0; k < block; k++) diff = std::max(diff, fabs(a[k] - b[k]));
+
+            const double ts = _time([&]()
+            {
+                for (size_t k = 0; k < block; k++) a[k] = sample->filter(signal[k]);
+            }) / block;
+
+            const double tb = _time([&]()
+            {
+                blocked->filter(signal.data(), b.data(), block);
+            }) / block;
+
+            printf("%8zu %12.2f %12.2f %8.2f %12.3f %10.2e\n", S, ts, tb, ts / tb, tb / S, diff);
+        }
+
+        printf("\n");
+    }
+
+
+    /* max |a - b| */
+    double _diff(const std::vector<double> &a, const std::vector<double> &b)
+    {
+        double res = 0.0;
+        for (size_t k = 0; k < a.size(); k++) res = std::max(res, fabs(a[k] - b[k]));
+
+        return res;
+    }
+
+
+    template <size_t NStages>
+    void _preset(const char *name, const MlxStaticSOSFilter<NStages> &preset, std::shared_ptr<MlxSOSFilter> dynamic, const std::vector<double> &signal)
+    {
+        const size_t block = signal.size();
+        std::vector<double> a(block), b(block), c(block), d(block);
+
+        if (dynamic->stages() != NStages)
+        {
+            printf("%-24s %6zu %12s\n", name, NStages, "no design");
+            return;
+        }
+
+        MlxStaticSOSFilter<NStages> stat = preset;
+
+        // same Output from the same (zero) State, per Sample and per Block
+        for (size_t k = 0; k < block; k++) a[k] = dynamic->filter(signal[k]);
+        for (size_t k = 0; k < block; k++) b[k] = stat.filter(signal[k]);
+
+        dynamic->reset();
+        stat.reset();
+
+        dynamic->filter(signal.data(), c.data(), block);
+        stat.filter(signal.data(), d.data(), block);
+
+        const double diff = std::max(_diff(a, b), _diff(c, d));
+
+        const double tds = _time([&]()
+        {
+            for (size_t k = 0; k < block; k++) a[k] = dynamic->filter(signal[k]);
+        }) / block;
+
+        const double tss = _time([&]()
+        {
+            for (size_t k = 0; k < block; k++) b[k] = stat.filter(signal[k]);
+        }) / block;
+
+        const double tdb = _time([&]()
+        {
+            dynamic->filter(signal.data(), c.data(), block);
+        }) / block;
+
+        const double tsb = _time([&]()
+        {
+            stat.filter(signal.data(), d.data(), block);
+        }) / block;
+
+        printf("%-24s %6zu %12.2f %12.2f %8.2f %12.2f %12.2f %8.2f %10.2e\n", name, NStages, tds, tss, tds / tss, tdb, tsb, tdb / tsb, diff);
+    }
+
+
+    void _presets(size_t block)
+    {
+        const std::vector<double> signal = _signal(block);
+
+        printf("# Presets: dynamic MlxSOSFilter vs. MlxStaticSOSFilter, Blocks of %zu Samples, Times in ns per Sample\n", block);
+        printf("%-24s %6s %12s %12s %8s %12s %12s %8s %10s\n", "preset", "stages", "dyn/sample", "stat/sample", "speedup", "dyn/block", "stat/block", "speedup", "max|diff|");
+
+        _preset("MLX_SOS_BUTTERWORTH_10P", MLX_SOS_BUTTERWORTH_10P, MlxSOSFilterFactory::getFilter_Butterworth(MlxSOSFilterFactory::ratio_10p), signal);
+        _preset("MLX_SOS_BESSEL_05P", MLX_SOS_BESSEL_05P, MlxSOSFilterFactory::getFilter_Bessel(MlxSOSFilterFactory::ratio_05p), signal);
+        _preset("MLX_SOS_BESSEL_10P", MLX_SOS_BESSEL_10P, MlxSOSFilterFactory::getFilter_Bessel(MlxSOSFilterFactory::ratio_10p), signal);
+
+        printf("\n");
+    }
+
+}   /* anonymous namespace */
+
+
+
+int main(int argc, char **argv)
+{
+    const size_t block = (argc > 1) ? size_t(strtoull(argv[1], nullptr, 10)) : MLX_BENCH_BLOCK;
+
+    _cascades(std::max<size_t>(1, block));
+    _presets(std::max<size_t>(1, block));
+
+    return 0;
+}
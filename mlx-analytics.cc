@@ -19,6 +19,12 @@
 
 #include "mlx-analytics.h"
 #include "mlx-gaussian-filter.h"
+#include "mlx-filtfilt.h"
+#include "mlx-resampler.h"
+#include "mlx-fft-plan-cache.h"
+#include "mlx-fft-batch.h"
+#include "mlx-welch.h"
+#include "mlx-zoom-fft.h"
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_fft.h>
@@ -29,9 +35,6 @@
 
 namespace mlx
 {
-    std::unordered_map<size_t, MlxMixedRadixRealFFT*> MlxAnalyticsInterface::_fft_real_workspaces = {};
-
-
     MlxAnalyticsInterface::MlxAnalyticsInterface()
     {
     }
@@ -39,7 +42,6 @@ namespace mlx
 
     MlxAnalyticsInterface::~MlxAnalyticsInterface()
     {
-        _freeFFTWorkspaces();
     }
 
 
@@ -74,26 +76,31 @@ namespace mlx
 
     std::shared_ptr<MlxVector> MlxAnalyticsInterface::filtfilt(std::shared_ptr<MlxVector> signal, std::shared_ptr<MlxSOSFilter> filter)
     {
+        std::shared_ptr<MlxVector> out = std::make_shared<MlxVector>(signal->size());
 
-        std::vector<double> inp = signal->toStdVector();
-        std::vector<double> tmp;
-        std::vector<double> res;
+        MlxZeroPhaseFilter zpf(filter, MLX_PADDING_ODD);
 
-        for (const auto& v : inp)
+        if (!zpf.apply(signal, out))
         {
-            tmp.push_back(filter->filter(v));
+            // Signal shorter than the Edge Extension
+            MlxZeroPhaseFilter unpadded(filter, MLX_PADDING_NONE);
+            unpadded.apply(signal, out);
         }
 
-        std::reverse(tmp.begin(), tmp.end());
+        return out;
+    }
+
 
-        for (const auto& v : tmp)
-        {
-            res.push_back(filter->filter(v));
-        }
+    std::shared_ptr<MlxFixedVector<double>> MlxAnalyticsInterface::resample(MlxFixedVector<double> &signal, size_t up, size_t down)
+    {
+        std::vector<double> in(signal.size());
+        for (size_t k = 0; k < in.size(); k++) in[k] = signal[k];
 
-        std::reverse(res.begin(), res.end());
+        std::vector<double> out;
+        MlxPolyphaseResampler resampler(up, down);
+        resampler.resample(in.data(), in.size(), out);
 
-        return std::make_shared<MlxVector>(res);;
+        return std::make_shared<MlxFixedVector<double>>(out);
     }
 
 
@@ -117,10 +124,24 @@ namespace mlx
 
     std::shared_ptr<MlxFixedVector<double>> MlxAnalyticsInterface::FFTMagnitude(MlxFixedVector<double> &signal, const double fs)
     {
-        MlxMixedRadixRealFFT *_fft = _getFFTWorkspace(signal.size());
+        std::shared_ptr<MlxMixedRadixRealFFT> _fft = MlxFFTPlanCache::global().acquire(signal.size());
+        if (!_fft) return std::make_shared<MlxFixedVector<double>>(0);
+
         return _fft->normalizedMagnitude(signal);
     }
 
+    std::shared_ptr<MlxFixedVector<double>> MlxAnalyticsInterface::ZoomFFTMagnitude(MlxFixedVector<double> &signal, const double fs, const double f0, const double f1, size_t bins)
+    {
+        MlxZoomFFT zoom(signal.size(), fs, f0, f1, bins);
+        if (zoom.fftLength() == 0) return std::make_shared<MlxFixedVector<double>>(0);
+
+        std::shared_ptr<MlxFixedVector<double>> res = std::make_shared<MlxFixedVector<double>>(bins);
+        if (!zoom.magnitude(&signal[0], &(*res)[0])) return std::make_shared<MlxFixedVector<double>>(0);
+
+        return res;
+    }
+
+
 /*
     std::shared_ptr<MlxFixedVector<double>> MlxAnalyticsInterface::PowerSpectralDensity(MlxFixedVector<double> &signal, const double fs)
     {
@@ -130,49 +151,129 @@ namespace mlx
     std::shared_ptr<MlxFixedVector<double>> MlxAnalyticsInterface::PowerSpectralDensity(MlxFixedVector<double> &signal, const double fs, const double df)
     {
 
-        MlxMixedRadixRealFFT *_fft = _getFFTWorkspace(signal.size());      
+        std::shared_ptr<MlxMixedRadixRealFFT> _fft = MlxFFTPlanCache::global().acquire(signal.size());
+        if (!_fft) return std::make_shared<MlxFixedVector<double>>(0);
+
         return _fft->pwrSpectralDensity(signal, fs, df);
     }
-    
 
 
-    MlxMixedRadixRealFFT* MlxAnalyticsInterface::_getFFTWorkspace(size_t length)
+    bool MlxAnalyticsInterface::FFTMagnitude(const double *signal, size_t n, double *out)
     {
+        std::shared_ptr<MlxMixedRadixRealFFT> _fft = MlxFFTPlanCache::global().acquire(n);
+        if (!_fft) return false;
 
-        if (auto search = _fft_real_workspaces.find(length); search != _fft_real_workspaces.end())
-        {
-            std::cout << "Using existing FFT Workspace!\n";
+        return _fft->normalizedMagnitude(signal, out);
+    }
 
-            // Workspace with given Length already exists
-            return search->second;
-        }
-        else
-        {
-            // create new Workspace with given Length
 
-            MlxMixedRadixRealFFT *_newWorkspace = new MlxMixedRadixRealFFT(length);
+    bool MlxAnalyticsInterface::PowerSpectralDensity(const double *signal, size_t n, double *out)
+    {
+        std::shared_ptr<MlxMixedRadixRealFFT> _fft = MlxFFTPlanCache::global().acquire(n);
+        if (!_fft) return false;
 
-            _fft_real_workspaces.insert(
-                std::make_pair(length, _newWorkspace)
-            );
+        return _fft->pwrSpectralDensity(signal, out);
+    }
 
-            std::cout << "Creating new FFT Workspace!\n";
 
-            return _newWorkspace;
-        }
+    std::shared_ptr<MlxFixedMatrix<double>> MlxAnalyticsInterface::FFTMagnitude(const MlxFixedMatrix<double> &frames)
+    {
+        MlxBatchRealFFT batch(frames.cols());
+        return batch.magnitude(frames);
+    }
+
+
+    std::shared_ptr<MlxFixedMatrix<double>> MlxAnalyticsInterface::PowerSpectralDensity(const MlxFixedMatrix<double> &frames)
+    {
+        MlxBatchRealFFT batch(frames.cols());
+        return batch.powerSpectrum(frames);
+    }
 
-        return nullptr;
+
+    std::shared_ptr<MlxFixedVector<double>> MlxAnalyticsInterface::WelchPSD(MlxFixedVector<double> &signal, const double fs, size_t segmentLength, const double df)
+    {
+        MlxWelchPSD welch(segmentLength, segmentLength / 2);
+
+        std::vector<double> in(signal.size());
+        for (size_t k = 0; k < in.size(); k++) in[k] = signal.at(k);
+
+        std::vector<double> out((df > 0) ? spectralBandCount(welch.bins(), fs / welch.segmentLength(), df) : welch.bins());
+
+        const bool ok = (df > 0)
+            ? welch.computeBands(in.data(), in.size(), fs, df, out.data())
+            : welch.compute(in.data(), in.size(), fs, out.data());
+
+        if (!ok) out.clear();
+
+        return std::make_shared<MlxFixedVector<double>>(out);
     }
 
-    void MlxAnalyticsInterface::_freeFFTWorkspaces()
+
+    std::shared_ptr<MlxVector> MlxAnalyticsInterface::WVT(std::shared_ptr<MlxVector> signal, double /*fs*/)
     {
-        for (auto it = _fft_real_workspaces.begin(); it != _fft_real_workspaces.end();)
+        const std::vector<double> x = signal->toStdVector();
+        const size_t n = x.size();
+
+        // Scales 4 ... n / 4 Samples, 8 Voices per Octave
+        const double s0 = 4.0;
+        const double dj = 0.125;
+        if (n < (4 * s0)) return std::make_shared<MlxVector>(std::vector<double>());
+
+        const size_t count = size_t(floor(log2(n / (4.0 * s0)) / dj)) + 1;
+
+        MlxContinuousWaveletTransform cwt(n, MlxContinuousWaveletTransform::geometricScales(s0, dj, count));
+        std::shared_ptr<MlxFixedMatrix<double>> mag = cwt.magnitude(x.data());
+        if (!mag) return std::make_shared<MlxVector>(std::vector<double>());
+
+        std::vector<double> res(count, 0.0);
+
+        for (size_t j = 0; j < count; j++)
         {
-            delete(it->second);
-            _fft_real_workspaces.erase(it);
+            const double *row = mag->row(j);
+
+            for (size_t t = 0; t < n; t++)
+            {
+                res[j] += row[t] * row[t];
+            }
+
+            res[j] /= n;
         }
+
+        return std::make_shared<MlxVector>(res);
     }
 
 
+    std::shared_ptr<MlxFixedMatrix<double>> MlxAnalyticsInterface::Scalogram(MlxFixedVector<double> &signal, const double fs, const double fmin, const double fmax,
+        size_t voices, CWTWavelet_t wavelet)
+    {
+        if ((signal.size() == 0) || (voices == 0) || !(fmin > 0.0) || !(fmax >= fmin) || !(fmax <= (fs / 2))) return nullptr;
+
+        const double s0 = MlxContinuousWaveletTransform::scaleForFrequency(fmax, fs, wavelet);
+
+        // Scales below the Minimum would return biased Rows (Wavelet Spectrum cut at Nyquist)
+        if (s0 < (MlxContinuousWaveletTransform::minimumScale(wavelet) * (1.0 - 1e-12))) return nullptr;
+
+        const double dj = 1.0 / voices;
+        const size_t count = size_t(floor(log2(fmax / fmin) / dj)) + 1;
+
+        MlxContinuousWaveletTransform cwt(signal.size(), MlxContinuousWaveletTransform::geometricScales(s0, dj, count), wavelet);
+
+        return cwt.magnitude(&signal[0]);
+    }
+
+
+    std::shared_ptr<MlxFixedMatrix<double>> MlxAnalyticsInterface::WaveletDenoise(const MlxFixedMatrix<double> &channels, WaveletTemplate_t family,
+        size_t member, WaveletThreshold_t mode, size_t levels)
+    {
+        MlxBatchWaveletDenoiser denoiser(family, member, channels.cols(), levels);
+        if (!denoiser.valid()) return nullptr;
+
+        std::shared_ptr<MlxFixedMatrix<double>> res = std::make_shared<MlxFixedMatrix<double>>(channels.rows(), channels.cols());
+        if (!denoiser.denoise(channels.data(), channels.rows(), res->data(), mode)) return nullptr;
+
+        return res;
+    }
+    
+
 
 }   /* namespace mlx */
\ No newline at end of file
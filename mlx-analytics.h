@@ -18,12 +18,14 @@
 
 #include <vector>
 #include <memory>
-#include <unordered_map>
 
 
 #include "structures/mlx-vector.h"
+#include "structures/mlx-matrix.h"
 #include "mlx-fft.h"
 #include "mlx-sos-filter.h"
+#include "mlx-scalogram.h"
+#include "mlx-wavelet-denoise.h"
 
 
 namespace mlx 
@@ -77,6 +79,19 @@ namespace mlx
         static std::shared_ptr<MlxFixedVector<double>> FFTFrequencies(MlxFixedVector<double> &signal, const double fs);
 
 
+        /**
+         * @brief   FFT Magnitude on a fine Frequency Grid within [f0, f1] (Chirp-Z, see MlxZoomFFT)
+         * 
+         * @param   signal    Input Signal
+         * @param   fs        Sample Frequency
+         * @param   f0        first Frequency in Hz
+         * @param   f1        last Frequency in Hz
+         * @param   bins      Number of Frequencies (Spacing (f1 - f0) / (bins - 1))
+         * @return  bins Values, Scaling as FFTMagnitude; empty on Error
+         */
+        static std::shared_ptr<MlxFixedVector<double>> ZoomFFTMagnitude(MlxFixedVector<double> &signal, const double fs, const double f0, const double f1, size_t bins);
+
+
         /**
          * @brief   Calculate Power Spectral Density
          * 
@@ -89,15 +104,125 @@ namespace mlx
         static std::shared_ptr<MlxFixedVector<double>> PowerSpectralDensity(MlxFixedVector<double> &signal, const double fs, const double df);
 
 
+        /**
+         * @brief   FFT Magnitude into a Caller Buffer (no Heap Allocation once the Plan is cached)
+         * 
+         * @param   signal    Input Samples
+         * @param   n         Number of Samples
+         * @param   out       n Values, Layout as FFTMagnitude
+         * @return  false on Error
+         */
+        static bool FFTMagnitude(const double *signal, size_t n, double *out);
+
+
+        /**
+         * @brief   Power Spectrum into a Caller Buffer (no Heap Allocation once the Plan is cached)
+         * 
+         * @param   signal    Input Samples
+         * @param   n         Number of Samples
+         * @param   out       n / 2 + 1 Values (DC ... Nyquist)
+         * @return  false on Error
+         */
+        static bool PowerSpectralDensity(const double *signal, size_t n, double *out);
+
+
+        /**
+         * @brief   FFT Magnitudes of many equal-length Frames (see MlxBatchRealFFT)
+         * 
+         * @param   frames    One Frame per Row
+         * @return  One Magnitude per Row, nullptr on Error
+         */
+        static std::shared_ptr<MlxFixedMatrix<double>> FFTMagnitude(const MlxFixedMatrix<double> &frames);
+
+
+        /**
+         * @brief   Power Spectra of many equal-length Frames (see MlxBatchRealFFT)
+         * 
+         * @param   frames    One Frame per Row
+         * @return  One Power Spectrum (cols / 2 + 1 Values) per Row, nullptr on Error
+         */
+        static std::shared_ptr<MlxFixedMatrix<double>> PowerSpectralDensity(const MlxFixedMatrix<double> &frames);
+
+
+        /**
+         * @brief   Welch PSD with Hann Window, 50% Overlap and Mean Removal (see MlxWelchPSD)
+         * 
+         * @param   signal          Input Signal
+         * @param   fs              Sample Frequency
+         * @param   segmentLength   Samples per Segment
+         * @param   df              Band Width in Hz - if 0, the PSD per Bin (Units^2 / Hz) is returned
+         * @return  PSD or Band Powers, empty if the Signal is shorter than one Segment
+         */
+        static std::shared_ptr<MlxFixedVector<double>> WelchPSD(MlxFixedVector<double> &signal, const double fs, size_t segmentLength, const double df = 0);
+
+
+        /**
+         * @brief   Global Wavelet Spectrum: time-averaged Morlet Power |W(s, t)|^2 per Scale
+         * 
+         *  Scales s_j = 4 * 2^(j / 8) Samples up to a Quarter of the Signal, Scale j
+         *  corresponds to the Frequency fs (6 + sqrt(38)) / (4 pi s_j).
+         * 
+         * @param   signal    Input Signal
+         * @param   fs        Sample Frequency
+         * @return  one Value per Scale, empty if the Signal is too short
+         */
         static std::shared_ptr<MlxVector> WVT(std::shared_ptr<MlxVector> signal, double fs);
 
 
+        /**
+         * @brief   CWT Scalogram |W(s, t)| (see MlxContinuousWaveletTransform)
+         * 
+         * @param   signal    Input Signal
+         * @param   fs        Sample Frequency
+         * @param   fmin      lowest Frequency in Hz, its Scale must fit the padded Transform (about 2 N Samples)
+         * @param   fmax      highest Frequency in Hz, at most the Frequency of
+         *                    MlxContinuousWaveletTransform::minimumScale() (Morlet: 0.34 fs)
+         * @param   voices    Scales per Octave
+         * @param   wavelet   Mother Wavelet
+         * @return  One Row per Scale (fmax first), nullptr on Error
+         */
+        static std::shared_ptr<MlxFixedMatrix<double>> Scalogram(MlxFixedVector<double> &signal, const double fs, const double fmin, const double fmax,
+            size_t voices = 8, CWTWavelet_t wavelet = MLX_CWT_MORLET);
+
+
+        /**
+         * @brief   Wavelet Denoising of many equal-length Channels (see MlxBatchWaveletDenoiser)
+         * 
+         * @param   channels  One Channel per Row (cols divisible by 2^levels)
+         * @param   family    Wavelet Family
+         * @param   member    Family Member
+         * @param   mode      Threshold Rule
+         * @param   levels    Decomposition Levels, 0 for all
+         * @return  Denoised Channels, nullptr on Error
+         */
+        static std::shared_ptr<MlxFixedMatrix<double>> WaveletDenoise(const MlxFixedMatrix<double> &channels, WaveletTemplate_t family = GSL_WAVELET_DAUBECHIES,
+            size_t member = 4, WaveletThreshold_t mode = MLX_WVT_THRESHOLD_SOFT, size_t levels = 0);
+
+
         static std::shared_ptr<MlxVector> detectPeaks(std::shared_ptr<MlxVector> signal);
 
 
 
+        /**
+         * @brief   Zero-Phase Filtering with odd Edge Extension (see MlxZeroPhaseFilter)
+         * 
+         * @param signal    Input Signal
+         * @param filter    SOS Cascade, its State is overwritten
+         * @return          Filtered Signal Vector
+         */
         static std::shared_ptr<MlxVector> filtfilt(std::shared_ptr<MlxVector> signal, std::shared_ptr<MlxSOSFilter> filter);
 
+
+        /**
+         * @brief   Resample by rational Factor up / down (see MlxPolyphaseResampler)
+         * 
+         * @param signal    Input Signal
+         * @param up        Interpolation Factor
+         * @param down      Decimation Factor
+         * @return          Resampled Signal, ceil(size * up / down) Samples
+         */
+        static std::shared_ptr<MlxFixedVector<double>> resample(MlxFixedVector<double> &signal, size_t up, size_t down);
+
         
 
 
@@ -108,11 +233,6 @@ namespace mlx
         std::shared_ptr<MlxVector> _time;
         std::shared_ptr<MlxVector> _vals;
 
-        /* Managing of FFT Workspaces */
-        static std::unordered_map<size_t, MlxMixedRadixRealFFT*> _fft_real_workspaces;
-        static MlxMixedRadixRealFFT* _getFFTWorkspace(size_t length);
-        static void _freeFFTWorkspaces();
-
 
     }; /* MlxAnalyticsInterface*/
 
@@ -0,0 +1,203 @@
+/**
+ * @file    mlx-complex-fft.cc
+ * @brief   Complex Forward / Inverse FFT on MlxComplexVector
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-complex-fft.h"
+
+#include <algorithm>
+#include <gsl/gsl_errno.h>
+
+
+namespace mlx
+{
+
+    void unpackHalfComplex(const double *hc, size_t length, MlxComplexVector &out, bool full)
+    {
+        const size_t bins = (length == 0) ? 0 : ((length / 2) + 1);
+
+        out.resize(full ? length : bins);
+        if (length == 0) return;
+
+        out.set(0, std::complex<double>(hc[0], 0.0));
+
+        for (size_t k = 1; k < bins; k++)
+        {
+            // Nyquist Term of even Lengths has no imaginary Part
+            const double re = hc[(2 * k) - 1];
+            const double im = ((2 * k) < length) ? hc[2 * k] : 0.0;
+
+            out.set(k, std::complex<double>(re, im));
+            if (full && ((length - k) != k)) out.set(length - k, std::complex<double>(re, -im));
+        }
+    }
+
+
+
+    MlxComplexFFT::MlxComplexFFT(size_t length)
+    : _length(length)
+    , _wvt(nullptr)
+    , _wrk(nullptr)
+    {
+        if (MlxNativeComplexFFT::supported(length))
+        {
+            _native = std::make_unique<MlxNativeComplexFFT>(length);
+            _scratch.resize(4 * length);
+        }
+        else if (length > 0)
+        {
+            _wvt = gsl_fft_complex_wavetable_alloc(length);
+            _wrk = gsl_fft_complex_workspace_alloc(length);
+            _scratch.resize(2 * length);
+        }
+    }
+
+
+    MlxComplexFFT::~MlxComplexFFT()
+    {
+        if (_wvt != nullptr) gsl_fft_complex_wavetable_free(_wvt);
+        if (_wrk != nullptr) gsl_fft_complex_workspace_free(_wrk);
+    }
+
+
+    size_t MlxComplexFFT::length() const
+    {
+        return _length;
+    }
+
+
+    bool MlxComplexFFT::forward(MlxComplexVector &data)
+    {
+        return _transform(data, false);
+    }
+
+
+    bool MlxComplexFFT::inverse(MlxComplexVector &data)
+    {
+        return _transform(data, true);
+    }
+
+
+    bool MlxComplexFFT::forward(double *re, double *im)
+    {
+        return _split(re, im, false);
+    }
+
+
+    bool MlxComplexFFT::inverse(double *re, double *im)
+    {
+        return _split(re, im, true);
+    }
+
+
+    bool MlxComplexFFT::_transform(MlxComplexVector &data, bool inverse)
+    {
+        if (data.size() != _length) return false;
+        if (_length == 0) return true;
+
+        if (data.layout() == MLX_COMPLEX_SPLIT)
+        {
+            return _split(data.real(), data.imag(), inverse);
+        }
+
+        return _interleaved(data.data(), inverse);
+    }
+
+
+    bool MlxComplexFFT::_split(double *re, double *im, bool inverse)
+    {
+        const size_t N = _length;
+        if (N == 0) return true;
+
+        if (_native)
+        {
+            _native->transform(re, im, _scratch.data(), _scratch.data() + N, inverse);
+        }
+        else
+        {
+            // GSL works on interleaved Data
+            double *buf = _scratch.data();
+
+            for (size_t n = 0; n < N; n++)
+            {
+                buf[2 * n] = re[n];
+                buf[(2 * n) + 1] = im[n];
+            }
+
+            if (!_interleaved(buf, inverse)) return false;
+
+            for (size_t n = 0; n < N; n++)
+            {
+                re[n] = buf[2 * n];
+                im[n] = buf[(2 * n) + 1];
+            }
+
+            return true;
+        }
+
+        if (inverse)
+        {
+            const double scale = 1.0 / N;
+
+            for (size_t n = 0; n < N; n++)
+            {
+                re[n] *= scale;
+                im[n] *= scale;
+            }
+        }
+
+        return true;
+    }
+
+
+    bool MlxComplexFFT::_interleaved(double *data, bool inverse)
+    {
+        const size_t N = _length;
+        if (N == 0) return true;
+
+        if (_native)
+        {
+            // Native Transform works on split Data: [re | im | Stockham Partner]
+            double *re = _scratch.data();
+            double *im = _scratch.data() + N;
+
+            for (size_t n = 0; n < N; n++)
+            {
+                re[n] = data[2 * n];
+                im[n] = data[(2 * n) + 1];
+            }
+
+            _native->transform(re, im, _scratch.data() + (2 * N), _scratch.data() + (3 * N), inverse);
+
+            const double scale = inverse ? (1.0 / N) : 1.0;
+
+            for (size_t n = 0; n < N; n++)
+            {
+                data[2 * n] = scale * re[n];
+                data[(2 * n) + 1] = scale * im[n];
+            }
+
+            return true;
+        }
+
+        if ((_wvt == nullptr) || (_wrk == nullptr)) return false;
+
+        const int status = inverse
+            ? gsl_fft_complex_inverse(data, 1, N, _wvt, _wrk)
+            : gsl_fft_complex_forward(data, 1, N, _wvt, _wrk);
+
+        return (status == GSL_SUCCESS);
+    }
+
+
+}   /* namespace mlx */
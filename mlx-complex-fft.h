@@ -0,0 +1,108 @@
+/**
+ * @file    mlx-complex-fft.h
+ * @brief   Complex Forward / Inverse FFT on MlxComplexVector
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+#include <gsl/gsl_fft_complex.h>
+
+#include "structures/mlx-vector.h"
+#include "mlx-fft-backend.h"
+
+
+namespace mlx
+{
+
+    /**
+     * @brief   Unpack GSL Half Complex Coefficients of a real Transform
+     *
+     * @param hc        length Coefficients (see MlxMixedRadixRealFFT::transform)
+     * @param length    Transform Length
+     * @param out       Spectrum, resized to length / 2 + 1 Bins (DC ... Nyquist)
+     *                  or length Bins if full; the Layout of out is kept
+     * @param full      add the conjugate-symmetric upper Half
+     */
+    void unpackHalfComplex(const double *hc, size_t length, MlxComplexVector &out, bool full = false);
+
+
+    /**
+     * @brief   Complex FFT Plan of one Length
+     *
+     *  Powers of Two run on MlxNativeComplexFFT (split Layout), all other Lengths on
+     *  the GSL mixed-radix Transform (interleaved Layout). Input in the other Layout
+     *  is converted in the Plan's Scratch Buffer, the Vector keeps its Layout.
+     *  A Plan must not be used by two Threads at once.
+     */
+    class MlxComplexFFT
+    {
+    public:
+
+        MlxComplexFFT(size_t length);
+        ~MlxComplexFFT();
+
+        MlxComplexFFT(const MlxComplexFFT&) = delete;
+        void operator= (const MlxComplexFFT&) = delete;
+
+
+        size_t length() const;
+
+
+        /**
+         * @brief   In-place Forward Transform, exp(-2 pi i k n / N) Kernel, unscaled
+         *
+         * @param data  length() Values
+         * @return      false on Length Mismatch or GSL Error
+         */
+        bool forward(MlxComplexVector &data);
+
+        /**
+         * @brief   In-place Inverse Transform, scaled by 1 / N
+         */
+        bool inverse(MlxComplexVector &data);
+
+        /**
+         * @brief   Split Array Variants
+         *
+         * @param re    length() Real Parts
+         * @param im    length() imaginary Parts
+         */
+        bool forward(double *re, double *im);
+        bool inverse(double *re, double *im);
+
+
+    protected:
+
+        bool _transform(MlxComplexVector &data, bool inverse);
+        bool _split(double *re, double *im, bool inverse);
+        bool _interleaved(double *data, bool inverse);
+
+        const size_t _length;
+
+        std::unique_ptr<MlxNativeComplexFFT> _native;
+        gsl_fft_complex_wavetable *_wvt;
+        gsl_fft_complex_workspace *_wrk;
+
+        // Layout Conversion (2 N) and Stockham Partner Buffer (2 N)
+        std::vector<double> _scratch;
+
+
+    };  /* MlxComplexFFT */
+
+
+}   /* namespace mlx */
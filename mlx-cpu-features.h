@@ -0,0 +1,71 @@
+/**
+ * @file    mlx-cpu-features.h
+ * @brief   Runtime Detection of SIMD Extensions for Kernel Dispatch
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+
+/*
+ *  Defined where Kernels can be compiled with __attribute__((target(...))) and selected
+ *  at Runtime. Such a Kernel is an always_inline Function plus a Wrapper with the Target
+ *  Attribute, the Wrapper is only called if the matching Query below returns true.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MLX_X86_DISPATCH
+#endif
+
+
+namespace mlx
+{
+
+    /**
+     * @brief   true if the CPU supports AVX2 and FMA (evaluated once)
+     */
+    inline bool mlxCpuHasAvx2Fma()
+    {
+#ifdef MLX_X86_DISPATCH
+        static const bool res = []()
+        {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        }();
+
+        return res;
+#else
+        return false;
+#endif
+    }
+
+
+    /**
+     * @brief   true if the CPU supports AVX-512 Foundation (evaluated once)
+     */
+    inline bool mlxCpuHasAvx512f()
+    {
+#ifdef MLX_X86_DISPATCH
+        static const bool res = []()
+        {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx512f");
+        }();
+
+        return res;
+#else
+        return false;
+#endif
+    }
+
+
+}   /* namespace mlx */
@@ -19,11 +19,6 @@
 #include <gsl/gsl_errno.h>
 
 
-extern gsl_wavelet_type *mlx_wavelet_gaussian;
-extern gsl_wavelet_type *mlx_wavelet_gaussian_centered;
-extern double mlx_default_gaussian_wavelet_alpha;
-
-
 namespace mlx {
 
 
@@ -40,24 +35,71 @@ namespace mlx {
 
 
     MlxWaveletTransformation::MlxWaveletTransformation(size_t win_length, size_t wvt_length)
+    : MlxWaveletTransformation(win_length, wvt_length, MLX_WAVELET_GAUSS_CENTERED)
+    {
+    }
+
+
+    MlxWaveletTransformation::MlxWaveletTransformation(size_t win_length, size_t wvt_length, WaveletTemplate_t wvt_template)
     : _length(win_length)
+    , _wavelet(nullptr)
     , _wrk(gsl_wavelet_workspace_alloc(win_length))
     {
-        //_wavelet = mlx_gauss_wavelet_allocate(2.8, 10);
-        _wavelet = gsl_wavelet_alloc(mlx_wavelet_gaussian_centered, wvt_length);
-        //gsl_wavelet_alloc(gsl_wavelet_bspline, 204);
+        const double alpha = MlxWaveletRegistry::defaultAlpha(wvt_template, wvt_length);
+
+        _bank = MlxWaveletRegistry::global().acquire(wvt_template, alpha, wvt_length);
+        if (_bank) _wavelet = _bank->wavelet();
+
+        // Lifting only where it reproduces GSL's Coefficients
+        if ((wvt_template == GSL_WAVELET_HAAR) || (wvt_template == GSL_WAVELET_DAUBECHIES))
+        {
+            if (MlxLiftingDWT::supported(wvt_template, wvt_length))
+            {
+                _lifting = std::make_unique<MlxLiftingDWT>(wvt_template, wvt_length, win_length);
+            }
+        }
     }
 
 
     MlxWaveletTransformation::~MlxWaveletTransformation()
     {
-        gsl_wavelet_free(_wavelet);
+        // Coefficients belong to the shared Filter Bank
         gsl_wavelet_workspace_free(_wrk);
     }
 
 
+    size_t MlxWaveletTransformation::length() const
+    {
+        return _length;
+    }
+
+
+    bool MlxWaveletTransformation::valid() const
+    {
+        return (_wavelet != nullptr);
+    }
+
+
+    const std::shared_ptr<const MlxWaveletFilterBank>& MlxWaveletTransformation::filterBank() const
+    {
+        return _bank;
+    }
+
+
     std::shared_ptr<MlxFixedVector<double>> MlxWaveletTransformation::WVT_1D(const MlxFixedVector<double> &signal)
     {
+        if (_wavelet == nullptr) return std::make_shared<MlxFixedVector<double>>(0);
+
+        const size_t n = signal.size();
+
+        if (_lifting && (n > 0) && (n <= _length) && ((n & (n - 1)) == 0))
+        {
+            std::shared_ptr<MlxFixedVector<double>> res = std::make_shared<MlxFixedVector<double>>(signal);
+            _lifting->forward(&(*res)[0], n);
+
+            return res;
+        }
+
         gsl_vector *inp = signal.toGslVector();
 
         gsl_wavelet_transform_forward(_wavelet, inp->data, 1, inp->size, _wrk);
@@ -71,6 +113,8 @@ namespace mlx {
 
     void MlxWaveletTransformation::outputWvt(std::ofstream &fst, size_t padding) const
     {
+        if (_wavelet == nullptr) return;
+
         fst << _wavelet->nc;
 
         for (size_t n = 0; n < padding; n++)
@@ -19,6 +19,8 @@
 
 #include "structures/mlx-vector.h"
 #include "wavelets/mlx-wvt-gauss.h"
+#include "mlx-wavelet-registry.h"
+#include "mlx-lifting-dwt.h"
 #include <math.h>
 #include <fstream>
 #include <gsl/gsl_wavelet.h>
@@ -27,19 +29,12 @@
 namespace mlx {
     
 
-typedef enum {
-    MLX_WAVELET_GAUSS = 1,
-    MLX_WAVELET_GAUSS_CENTERED = 11,
-    GLS_WAVELET_BSPLINE = 2,
-    GLS_WAVELET_BSPLINE_CENTERED = 21,
-    GSL_WAVELET_DAUBECHIES = 3,
-    GSL_WAVELET_DAUBECHIES_CENTERED = 31,
-    GSL_WAVELET_HAAR = 4,
-    GSL_WAVELET_HAAR_CENTERED = 41,
-} WaveletTemplate_t;
-
-
-
+/**
+ * @brief   Discrete Wavelet Transformation on a shared Filter Bank (see MlxWaveletRegistry)
+ * 
+ *  Construction only looks up the Coefficients, any Number of Transformations
+ *  (also on different Threads) share one immutable Table per Wavelet.
+ */
 class MlxWaveletTransformation
 {
 public:
@@ -49,10 +44,23 @@ public:
 
     size_t length() const;
 
+    /**
+     * @brief   false if the Wavelet Member is not supported by its Family
+     */
+    bool valid() const;
+
+    const std::shared_ptr<const MlxWaveletFilterBank>& filterBank() const;
+
 
     void outputWvt(std::ofstream &fst, size_t padding) const;
 
 
+    /**
+     * @brief   Full Decomposition, GSL Layout
+     * 
+     *  Haar, Daubechies 2 / 4 and B-Spline 202 run in-place as Lifting Scheme (see
+     *  MlxLiftingDWT) with the same Coefficients, the other Wavelets through GSL.
+     */
     std::shared_ptr<MlxFixedVector<double>> WVT_1D(const MlxFixedVector<double> &signal);
 
 
@@ -61,9 +69,12 @@ protected:
 
     const size_t _length;
 
-    gsl_wavelet *_wavelet;
+    std::shared_ptr<const MlxWaveletFilterBank> _bank;
+    const gsl_wavelet *_wavelet;
     gsl_wavelet_workspace *_wrk;
 
+    std::unique_ptr<MlxLiftingDWT> _lifting;
+
 
 
 };   /* MlxWaveletTransformation1D */
@@ -0,0 +1,1223 @@
+/**
+ * @file    mlx-fft-backend.cc
+ * @brief   Exchangeable Real FFT Implementations (GSL mixed-radix, native power-of-two)
+ *          in double and single Precision
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-fft-backend.h"
+#include "mlx-cpu-features.h"
+
+#include <math.h>
+#include <algorithm>
+#include <type_traits>
+#include <gsl/gsl_errno.h>
+
+#ifdef MLX_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+
+namespace mlx
+{
+
+    bool fftSmoothLength(size_t length)
+    {
+        if (length == 0) return false;
+
+        for (size_t p = 2; p <= MLX_FFT_SMOOTH_RADIX; p++)
+        {
+            while ((length % p) == 0) length /= p;
+        }
+
+        return (length == 1);
+    }
+
+
+    size_t fftFastLength(size_t length)
+    {
+        if (length <= 1) return 1;
+
+        while (!fftSmoothLength(length)) length++;
+        return length;
+    }
+
+
+    template <typename T>
+    std::shared_ptr<const MlxBasicRealFFTBackend<T>> MlxBasicRealFFTBackend<T>::create(size_t length, FFTBackend_t type)
+    {
+        if (type == MLX_FFT_BACKEND_AUTO) type = select(length);
+
+        if ((type == MLX_FFT_BACKEND_NATIVE) && nativeSupported(length))
+        {
+            return std::make_shared<const MlxBasicNativeRealFFTBackend<T>>(length);
+        }
+
+        if ((type == MLX_FFT_BACKEND_BLUESTEIN) && (length > 1))
+        {
+            return std::make_shared<const MlxBasicBluesteinRealFFTBackend<T>>(length);
+        }
+
+        return std::make_shared<const MlxBasicGslRealFFTBackend<T>>(length);
+    }
+
+
+    template <typename T>
+    bool MlxBasicRealFFTBackend<T>::nativeSupported(size_t length)
+    {
+        return (length >= MLX_FFT_NATIVE_MIN_LENGTH) && ((length & (length - 1)) == 0);
+    }
+
+
+    template <typename T>
+    double MlxBasicRealFFTBackend<T>::gslCost(size_t length)
+    {
+        if (length < 2) return 0.0;
+
+        // Sum of the Prime Factors GSL has no dedicated Butterfly for
+        size_t rest = length;
+        double generic = 0.0;
+
+        for (size_t p = 2; (p * p) <= rest; p++)
+        {
+            while ((rest % p) == 0)
+            {
+                if (p > MLX_FFT_SMOOTH_RADIX) generic += p;
+                rest /= p;
+            }
+        }
+
+        if (rest > MLX_FFT_SMOOTH_RADIX) generic += rest;
+
+        return length * (log2(double(length)) + generic);
+    }
+
+
+    template <typename T>
+    double MlxBasicRealFFTBackend<T>::bluesteinCost(size_t length)
+    {
+        if (length < 2) return 0.0;
+
+        size_t L = 1;
+        while (L < ((2 * length) - 1)) L *= 2;
+
+        return L * log2(double(L));
+    }
+
+
+    template <typename T>
+    FFTBackend_t MlxBasicRealFFTBackend<T>::select(size_t length)
+    {
+        if (nativeSupported(length)) return MLX_FFT_BACKEND_NATIVE;
+        if (length < 2) return MLX_FFT_BACKEND_GSL;
+
+        return ((MLX_FFT_BLUESTEIN_WEIGHT * bluesteinCost(length)) < gslCost(length)) ? MLX_FFT_BACKEND_BLUESTEIN : MLX_FFT_BACKEND_GSL;
+    }
+
+
+
+/// Start - GSL Backend
+
+
+    namespace
+    {
+        /* GSL Functions per Precision */
+        template <typename T> struct _gsl_fft_t;
+
+        template <>
+        struct _gsl_fft_t<double>
+        {
+            typedef MlxGslFFTWavetables<double>::real_t real_t;
+            typedef MlxGslFFTWavetables<double>::halfcomplex_t halfcomplex_t;
+            typedef gsl_fft_real_workspace workspace_t;
+
+            static real_t* realAlloc(size_t n) { return gsl_fft_real_wavetable_alloc(n); };
+            static halfcomplex_t* halfcomplexAlloc(size_t n) { return gsl_fft_halfcomplex_wavetable_alloc(n); };
+            static workspace_t* workspaceAlloc(size_t n) { return gsl_fft_real_workspace_alloc(n); };
+
+            static void release(real_t *w) { gsl_fft_real_wavetable_free(w); };
+            static void release(halfcomplex_t *w) { gsl_fft_halfcomplex_wavetable_free(w); };
+            static void release(workspace_t *w) { gsl_fft_real_workspace_free(w); };
+
+            static int transform(double *data, size_t n, const real_t *wvt, workspace_t *wrk) { return gsl_fft_real_transform(data, 1, n, wvt, wrk); };
+            static int inverse(double *data, size_t n, const halfcomplex_t *wvt, workspace_t *wrk) { return gsl_fft_halfcomplex_inverse(data, 1, n, wvt, wrk); };
+        };
+
+        template <>
+        struct _gsl_fft_t<float>
+        {
+            typedef MlxGslFFTWavetables<float>::real_t real_t;
+            typedef MlxGslFFTWavetables<float>::halfcomplex_t halfcomplex_t;
+            typedef gsl_fft_real_workspace_float workspace_t;
+
+            static real_t* realAlloc(size_t n) { return gsl_fft_real_wavetable_float_alloc(n); };
+            static halfcomplex_t* halfcomplexAlloc(size_t n) { return gsl_fft_halfcomplex_wavetable_float_alloc(n); };
+            static workspace_t* workspaceAlloc(size_t n) { return gsl_fft_real_workspace_float_alloc(n); };
+
+            static void release(real_t *w) { gsl_fft_real_wavetable_float_free(w); };
+            static void release(halfcomplex_t *w) { gsl_fft_halfcomplex_wavetable_float_free(w); };
+            static void release(workspace_t *w) { gsl_fft_real_workspace_float_free(w); };
+
+            static int transform(float *data, size_t n, const real_t *wvt, workspace_t *wrk) { return gsl_fft_real_float_transform(data, 1, n, wvt, wrk); };
+            static int inverse(float *data, size_t n, const halfcomplex_t *wvt, workspace_t *wrk) { return gsl_fft_halfcomplex_float_inverse(data, 1, n, wvt, wrk); };
+        };
+
+
+        template <typename T>
+        class _gsl_workspace_t final : public MlxBasicRealFFTBackend<T>::Workspace
+        {
+        public:
+            _gsl_workspace_t(size_t length) : wrk((length > 0) ? _gsl_fft_t<T>::workspaceAlloc(length) : nullptr) {};
+            ~_gsl_workspace_t() { if (wrk != nullptr) _gsl_fft_t<T>::release(wrk); };
+
+            typename _gsl_fft_t<T>::workspace_t *wrk;
+        };
+    }
+
+
+    template <typename T>
+    MlxBasicGslRealFFTBackend<T>::MlxBasicGslRealFFTBackend(size_t length)
+    : _length(length)
+    , _wvt(nullptr)
+    , _hcWvt(nullptr)
+    {
+        // GSL's default Error Handler aborts on Length 0, transform() then returns false
+        if (length == 0) return;
+
+        _wvt = _gsl_fft_t<T>::realAlloc(length);
+        _hcWvt = _gsl_fft_t<T>::halfcomplexAlloc(length);
+    }
+
+
+    template <typename T>
+    MlxBasicGslRealFFTBackend<T>::~MlxBasicGslRealFFTBackend()
+    {
+        if (_wvt != nullptr) _gsl_fft_t<T>::release(_wvt);
+        if (_hcWvt != nullptr) _gsl_fft_t<T>::release(_hcWvt);
+    }
+
+
+    template <typename T>
+    size_t MlxBasicGslRealFFTBackend<T>::length() const
+    {
+        return _length;
+    }
+
+
+    template <typename T>
+    size_t MlxBasicGslRealFFTBackend<T>::bytes() const
+    {
+        // Structs plus n/2 complex Trigonometric Factors per Direction
+        return sizeof(*_wvt) + sizeof(*_hcWvt) + (((_length / 2) + 1) * 4 * sizeof(T));
+    }
+
+
+    template <typename T>
+    FFTBackend_t MlxBasicGslRealFFTBackend<T>::type() const
+    {
+        return MLX_FFT_BACKEND_GSL;
+    }
+
+
+    template <typename T>
+    std::unique_ptr<typename MlxBasicGslRealFFTBackend<T>::Workspace> MlxBasicGslRealFFTBackend<T>::createWorkspace() const
+    {
+        return std::make_unique<_gsl_workspace_t<T>>(_length);
+    }
+
+
+    template <typename T>
+    bool MlxBasicGslRealFFTBackend<T>::transform(T *data, Workspace &ws) const
+    {
+        if (_wvt == nullptr) return false;
+
+        _gsl_workspace_t<T> &gws = static_cast<_gsl_workspace_t<T>&>(ws);
+        return (_gsl_fft_t<T>::transform(data, _length, _wvt, gws.wrk) == GSL_SUCCESS);
+    }
+
+
+    template <typename T>
+    bool MlxBasicGslRealFFTBackend<T>::inverse(T *data, Workspace &ws) const
+    {
+        if (_hcWvt == nullptr) return false;
+
+        _gsl_workspace_t<T> &gws = static_cast<_gsl_workspace_t<T>&>(ws);
+        return (_gsl_fft_t<T>::inverse(data, _length, _hcWvt, gws.wrk) == GSL_SUCCESS);
+    }
+
+
+/// END - GSL Backend
+
+
+
+/// Start - Native Backend
+
+
+    namespace
+    {
+        /* First radix-4 Stage (Stride 1), Butterflies p0 ... n1 - 1 */
+        template <typename T>
+        inline __attribute__((always_inline))
+        void _mlx_radix4_first(const T *sr, const T *si, T *dr, T *di, size_t n1, size_t p0, const T *wr, const T *wi)
+        {
+            for (size_t p = p0; p < n1; p++)
+            {
+                const T apcr = sr[p] + sr[p + (2 * n1)], apci = si[p] + si[p + (2 * n1)];
+                const T amcr = sr[p] - sr[p + (2 * n1)], amci = si[p] - si[p + (2 * n1)];
+                const T bpdr = sr[p + n1] + sr[p + (3 * n1)], bpdi = si[p + n1] + si[p + (3 * n1)];
+                const T jbr = -(si[p + n1] - si[p + (3 * n1)]);
+                const T jbi = sr[p + n1] - sr[p + (3 * n1)];
+
+                const T u1r = amcr - jbr, u1i = amci - jbi;
+                const T u2r = apcr - bpdr, u2i = apci - bpdi;
+                const T u3r = amcr + jbr, u3i = amci + jbi;
+
+                dr[4 * p] = apcr + bpdr;
+                di[4 * p] = apci + bpdi;
+                dr[(4 * p) + 1] = (wr[p] * u1r) - (wi[p] * u1i);
+                di[(4 * p) + 1] = (wr[p] * u1i) + (wi[p] * u1r);
+                dr[(4 * p) + 2] = (wr[2 * p] * u2r) - (wi[2 * p] * u2i);
+                di[(4 * p) + 2] = (wr[2 * p] * u2i) + (wi[2 * p] * u2r);
+                dr[(4 * p) + 3] = (wr[3 * p] * u3r) - (wi[3 * p] * u3i);
+                di[(4 * p) + 3] = (wr[3 * p] * u3i) + (wi[3 * p] * u3r);
+            }
+        }
+
+
+        /* One radix-4 Stockham Stage: n1 = n / 4 Butterflies per Stride s */
+        template <typename T>
+        void _mlx_radix4_stage(const T *sr, const T *si, T *dr, T *di, size_t n1, size_t s, const T *wr, const T *wi)
+        {
+            if (s == 1)
+            {
+                // First Stage: Loop over Butterflies instead of the (single) Stride
+                _mlx_radix4_first(sr, si, dr, di, n1, 0, wr, wi);
+                return;
+            }
+
+            for (size_t p = 0; p < n1; p++)
+            {
+                const size_t t = p * s;
+
+                const T w1r = wr[t],     w1i = wi[t];
+                const T w2r = wr[2 * t], w2i = wi[2 * t];
+                const T w3r = wr[3 * t], w3i = wi[3 * t];
+
+                const T *ar_ = sr + (s * p);
+                const T *ai_ = si + (s * p);
+                const T *br_ = sr + (s * (p + n1));
+                const T *bi_ = si + (s * (p + n1));
+                const T *cr_ = sr + (s * (p + (2 * n1)));
+                const T *ci_ = si + (s * (p + (2 * n1)));
+                const T *er_ = sr + (s * (p + (3 * n1)));
+                const T *ei_ = si + (s * (p + (3 * n1)));
+
+                T *y0r = dr + (s * (4 * p));
+                T *y0i = di + (s * (4 * p));
+                T *y1r = y0r + s;
+                T *y1i = y0i + s;
+                T *y2r = y0r + (2 * s);
+                T *y2i = y0i + (2 * s);
+                T *y3r = y0r + (3 * s);
+                T *y3i = y0i + (3 * s);
+
+                for (size_t q = 0; q < s; q++)
+                {
+                    const T apcr = ar_[q] + cr_[q], apci = ai_[q] + ci_[q];
+                    const T amcr = ar_[q] - cr_[q], amci = ai_[q] - ci_[q];
+                    const T bpdr = br_[q] + er_[q], bpdi = bi_[q] + ei_[q];
+
+                    // j * (b - d)
+                    const T jbr = -(bi_[q] - ei_[q]);
+                    const T jbi = br_[q] - er_[q];
+
+                    y0r[q] = apcr + bpdr;
+                    y0i[q] = apci + bpdi;
+
+                    const T u1r = amcr - jbr, u1i = amci - jbi;
+                    const T u2r = apcr - bpdr, u2i = apci - bpdi;
+                    const T u3r = amcr + jbr, u3i = amci + jbi;
+
+                    y1r[q] = (w1r * u1r) - (w1i * u1i);
+                    y1i[q] = (w1r * u1i) + (w1i * u1r);
+                    y2r[q] = (w2r * u2r) - (w2i * u2i);
+                    y2i[q] = (w2r * u2i) + (w2i * u2r);
+                    y3r[q] = (w3r * u3r) - (w3i * u3i);
+                    y3i[q] = (w3r * u3i) + (w3i * u3r);
+                }
+            }
+        }
+
+
+#ifdef MLX_X86_DISPATCH
+        /* u w, (re, im) of four Values */
+        __attribute__((target("avx2,fma"))) inline __attribute__((always_inline))
+        void _mlx_cmul_avx2(__m256d ur, __m256d ui, __m256d wr, __m256d wi, __m256d &yr, __m256d &yi)
+        {
+            yr = _mm256_fmsub_pd(wr, ur, _mm256_mul_pd(wi, ui));
+            yi = _mm256_fmadd_pd(wr, ui, _mm256_mul_pd(wi, ur));
+        }
+
+
+        /* Radix-4 Butterfly of four Lanes: a, b, c, e -> y0, u1, u2, u3 (before the Twiddles) */
+        __attribute__((target("avx2,fma"))) inline __attribute__((always_inline))
+        void _mlx_butterfly4_avx2(__m256d ar, __m256d ai, __m256d br, __m256d bi, __m256d cr, __m256d ci, __m256d er, __m256d ei,
+            __m256d &y0r, __m256d &y0i, __m256d &u1r, __m256d &u1i, __m256d &u2r, __m256d &u2i, __m256d &u3r, __m256d &u3i)
+        {
+            const __m256d apcr = _mm256_add_pd(ar, cr), apci = _mm256_add_pd(ai, ci);
+            const __m256d amcr = _mm256_sub_pd(ar, cr), amci = _mm256_sub_pd(ai, ci);
+            const __m256d bpdr = _mm256_add_pd(br, er), bpdi = _mm256_add_pd(bi, ei);
+
+            // j * (b - d)
+            const __m256d jbr = _mm256_sub_pd(ei, bi);
+            const __m256d jbi = _mm256_sub_pd(br, er);
+
+            y0r = _mm256_add_pd(apcr, bpdr);
+            y0i = _mm256_add_pd(apci, bpdi);
+            u1r = _mm256_sub_pd(amcr, jbr);
+            u1i = _mm256_sub_pd(amci, jbi);
+            u2r = _mm256_sub_pd(apcr, bpdr);
+            u2i = _mm256_sub_pd(apci, bpdi);
+            u3r = _mm256_add_pd(amcr, jbr);
+            u3i = _mm256_add_pd(amci, jbi);
+        }
+
+
+        /* Rows y0 ... y3 (Lanes p ... p + 3) -> four Vectors (y0 y1 y2 y3) of p ... p + 3 */
+        __attribute__((target("avx2,fma"))) inline __attribute__((always_inline))
+        void _mlx_store4x4_avx2(double *d, __m256d y0, __m256d y1, __m256d y2, __m256d y3)
+        {
+            const __m256d t0 = _mm256_unpacklo_pd(y0, y1);
+            const __m256d t1 = _mm256_unpackhi_pd(y0, y1);
+            const __m256d t2 = _mm256_unpacklo_pd(y2, y3);
+            const __m256d t3 = _mm256_unpackhi_pd(y2, y3);
+
+            _mm256_storeu_pd(d, _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd(d + 4, _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd(d + 8, _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd(d + 12, _mm256_permute2f128_pd(t1, t3, 0x31));
+        }
+
+
+        /*
+         *  Same Stage with explicit AVX2 / FMA Butterflies: Strides s >= 4 run four q per
+         *  Vector with broadcast Twiddles, the first Stage runs four Butterflies p per Vector
+         *  (gathered Twiddles) and transposes them into the interleaved Output.
+         */
+        __attribute__((target("avx2,fma")))
+        void _mlx_radix4_stage_avx2(const double *sr, const double *si, double *dr, double *di, size_t n1, size_t s, const double *wr, const double *wi)
+        {
+            __m256d y0r, y0i, u1r, u1i, u2r, u2i, u3r, u3i;
+            __m256d y1r, y1i, y2r, y2i, y3r, y3i;
+
+            if (s == 1)
+            {
+                const __m256i idx2 = _mm256_set_epi64x(6, 4, 2, 0);
+                const __m256i idx3 = _mm256_set_epi64x(9, 6, 3, 0);
+
+                size_t p = 0;
+
+                for (; (p + 4) <= n1; p += 4)
+                {
+                    _mlx_butterfly4_avx2(
+                        _mm256_loadu_pd(sr + p), _mm256_loadu_pd(si + p),
+                        _mm256_loadu_pd(sr + p + n1), _mm256_loadu_pd(si + p + n1),
+                        _mm256_loadu_pd(sr + p + (2 * n1)), _mm256_loadu_pd(si + p + (2 * n1)),
+                        _mm256_loadu_pd(sr + p + (3 * n1)), _mm256_loadu_pd(si + p + (3 * n1)),
+                        y0r, y0i, u1r, u1i, u2r, u2i, u3r, u3i);
+
+                    _mlx_cmul_avx2(u1r, u1i, _mm256_loadu_pd(wr + p), _mm256_loadu_pd(wi + p), y1r, y1i);
+                    _mlx_cmul_avx2(u2r, u2i, _mm256_i64gather_pd(wr + (2 * p), idx2, 8), _mm256_i64gather_pd(wi + (2 * p), idx2, 8), y2r, y2i);
+                    _mlx_cmul_avx2(u3r, u3i, _mm256_i64gather_pd(wr + (3 * p), idx3, 8), _mm256_i64gather_pd(wi + (3 * p), idx3, 8), y3r, y3i);
+
+                    _mlx_store4x4_avx2(dr + (4 * p), y0r, y1r, y2r, y3r);
+                    _mlx_store4x4_avx2(di + (4 * p), y0i, y1i, y2i, y3i);
+                }
+
+                _mlx_radix4_first(sr, si, dr, di, n1, p, wr, wi);
+                return;
+            }
+
+            // Strides are Powers of Four, the Fallback only guards against other Callers
+            if ((s % 4) != 0)
+            {
+                _mlx_radix4_stage(sr, si, dr, di, n1, s, wr, wi);
+                return;
+            }
+
+            for (size_t p = 0; p < n1; p++)
+            {
+                const size_t t = p * s;
+
+                const __m256d w1r = _mm256_broadcast_sd(wr + t), w1i = _mm256_broadcast_sd(wi + t);
+                const __m256d w2r = _mm256_broadcast_sd(wr + (2 * t)), w2i = _mm256_broadcast_sd(wi + (2 * t));
+                const __m256d w3r = _mm256_broadcast_sd(wr + (3 * t)), w3i = _mm256_broadcast_sd(wi + (3 * t));
+
+                const double *ar_ = sr + (s * p);
+                const double *ai_ = si + (s * p);
+                const double *br_ = sr + (s * (p + n1));
+                const double *bi_ = si + (s * (p + n1));
+                const double *cr_ = sr + (s * (p + (2 * n1)));
+                const double *ci_ = si + (s * (p + (2 * n1)));
+                const double *er_ = sr + (s * (p + (3 * n1)));
+                const double *ei_ = si + (s * (p + (3 * n1)));
+
+                double *o0r = dr + (s * (4 * p));
+                double *o0i = di + (s * (4 * p));
+
+                for (size_t q = 0; q < s; q += 4)
+                {
+                    _mlx_butterfly4_avx2(
+                        _mm256_loadu_pd(ar_ + q), _mm256_loadu_pd(ai_ + q),
+                        _mm256_loadu_pd(br_ + q), _mm256_loadu_pd(bi_ + q),
+                        _mm256_loadu_pd(cr_ + q), _mm256_loadu_pd(ci_ + q),
+                        _mm256_loadu_pd(er_ + q), _mm256_loadu_pd(ei_ + q),
+                        y0r, y0i, u1r, u1i, u2r, u2i, u3r, u3i);
+
+                    _mlx_cmul_avx2(u1r, u1i, w1r, w1i, y1r, y1i);
+                    _mlx_cmul_avx2(u2r, u2i, w2r, w2i, y2r, y2i);
+                    _mlx_cmul_avx2(u3r, u3i, w3r, w3i, y3r, y3i);
+
+                    _mm256_storeu_pd(o0r + q, y0r);
+                    _mm256_storeu_pd(o0i + q, y0i);
+                    _mm256_storeu_pd(o0r + s + q, y1r);
+                    _mm256_storeu_pd(o0i + s + q, y1i);
+                    _mm256_storeu_pd(o0r + (2 * s) + q, y2r);
+                    _mm256_storeu_pd(o0i + (2 * s) + q, y2i);
+                    _mm256_storeu_pd(o0r + (3 * s) + q, y3r);
+                    _mm256_storeu_pd(o0i + (3 * s) + q, y3i);
+                }
+            }
+        }
+
+
+        /* u w, (re, im) of eight Values */
+        __attribute__((target("avx2,fma"))) inline __attribute__((always_inline))
+        void _mlx_cmul_avx2(__m256 ur, __m256 ui, __m256 wr, __m256 wi, __m256 &yr, __m256 &yi)
+        {
+            yr = _mm256_fmsub_ps(wr, ur, _mm256_mul_ps(wi, ui));
+            yi = _mm256_fmadd_ps(wr, ui, _mm256_mul_ps(wi, ur));
+        }
+
+
+        /* Radix-4 Butterfly of eight Lanes: a, b, c, e -> y0, u1, u2, u3 (before the Twiddles) */
+        __attribute__((target("avx2,fma"))) inline __attribute__((always_inline))
+        void _mlx_butterfly4_avx2(__m256 ar, __m256 ai, __m256 br, __m256 bi, __m256 cr, __m256 ci, __m256 er, __m256 ei,
+            __m256 &y0r, __m256 &y0i, __m256 &u1r, __m256 &u1i, __m256 &u2r, __m256 &u2i, __m256 &u3r, __m256 &u3i)
+        {
+            const __m256 apcr = _mm256_add_ps(ar, cr), apci = _mm256_add_ps(ai, ci);
+            const __m256 amcr = _mm256_sub_ps(ar, cr), amci = _mm256_sub_ps(ai, ci);
+            const __m256 bpdr = _mm256_add_ps(br, er), bpdi = _mm256_add_ps(bi, ei);
+
+            // j * (b - d)
+            const __m256 jbr = _mm256_sub_ps(ei, bi);
+            const __m256 jbi = _mm256_sub_ps(br, er);
+
+            y0r = _mm256_add_ps(apcr, bpdr);
+            y0i = _mm256_add_ps(apci, bpdi);
+            u1r = _mm256_sub_ps(amcr, jbr);
+            u1i = _mm256_sub_ps(amci, jbi);
+            u2r = _mm256_sub_ps(apcr, bpdr);
+            u2i = _mm256_sub_ps(apci, bpdi);
+            u3r = _mm256_add_ps(amcr, jbr);
+            u3i = _mm256_add_ps(amci, jbi);
+        }
+
+
+        /* Rows y0 ... y3 (Lanes p ... p + 7) -> eight Quadruples (y0 y1 y2 y3) of p ... p + 7 */
+        __attribute__((target("avx2,fma"))) inline __attribute__((always_inline))
+        void _mlx_store4x8_avx2(float *d, __m256 y0, __m256 y1, __m256 y2, __m256 y3)
+        {
+            const __m256 t0 = _mm256_unpacklo_ps(y0, y1);
+            const __m256 t1 = _mm256_unpackhi_ps(y0, y1);
+            const __m256 t2 = _mm256_unpacklo_ps(y2, y3);
+            const __m256 t3 = _mm256_unpackhi_ps(y2, y3);
+
+            // Quadruples of p, p + 4 / p + 1, p + 5 / ...
+            const __m256 q04 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 q15 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+            const __m256 q26 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 q37 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+
+            _mm256_storeu_ps(d, _mm256_permute2f128_ps(q04, q15, 0x20));
+            _mm256_storeu_ps(d + 8, _mm256_permute2f128_ps(q26, q37, 0x20));
+            _mm256_storeu_ps(d + 16, _mm256_permute2f128_ps(q04, q15, 0x31));
+            _mm256_storeu_ps(d + 24, _mm256_permute2f128_ps(q26, q37, 0x31));
+        }
+
+
+        /* Lanes 0 ... 3 to a, Lanes 4 ... 7 to b */
+        __attribute__((target("avx2,fma"))) inline __attribute__((always_inline))
+        void _mlx_store2x4_avx2(float *a, float *b, __m256 y)
+        {
+            _mm_storeu_ps(a, _mm256_castps256_ps128(y));
+            _mm_storeu_ps(b, _mm256_extractf128_ps(y, 1));
+        }
+
+
+        /* Twiddle of Butterfly p in Lanes 0 ... 3, of Butterfly p + 1 in Lanes 4 ... 7 */
+        __attribute__((target("avx2,fma"))) inline __attribute__((always_inline))
+        __m256 _mlx_broadcast2x4_avx2(const float *w, const float *w1)
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_broadcast_ss(w)), _mm_broadcast_ss(w1), 1);
+        }
+
+
+        /*
+         *  Single Precision Stage, eight Lanes per Vector: the first Stage runs eight
+         *  Butterflies p per Vector, Stride 4 two Butterflies p, p + 1 (their Inputs are
+         *  adjacent, their Outputs 4 s apart), Strides s >= 16 eight q per Vector.
+         */
+        __attribute__((target("avx2,fma")))
+        void _mlx_radix4_stage_avx2(const float *sr, const float *si, float *dr, float *di, size_t n1, size_t s, const float *wr, const float *wi)
+        {
+            __m256 y0r, y0i, u1r, u1i, u2r, u2i, u3r, u3i;
+            __m256 y1r, y1i, y2r, y2i, y3r, y3i;
+
+            if (s == 1)
+            {
+                const __m256i idx2 = _mm256_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14);
+                const __m256i idx3 = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+
+                size_t p = 0;
+
+                for (; (p + 8) <= n1; p += 8)
+                {
+                    _mlx_butterfly4_avx2(
+                        _mm256_loadu_ps(sr + p), _mm256_loadu_ps(si + p),
+                        _mm256_loadu_ps(sr + p + n1), _mm256_loadu_ps(si + p + n1),
+                        _mm256_loadu_ps(sr + p + (2 * n1)), _mm256_loadu_ps(si + p + (2 * n1)),
+                        _mm256_loadu_ps(sr + p + (3 * n1)), _mm256_loadu_ps(si + p + (3 * n1)),
+                        y0r, y0i, u1r, u1i, u2r, u2i, u3r, u3i);
+
+                    _mlx_cmul_avx2(u1r, u1i, _mm256_loadu_ps(wr + p), _mm256_loadu_ps(wi + p), y1r, y1i);
+                    _mlx_cmul_avx2(u2r, u2i, _mm256_i32gather_ps(wr + (2 * p), idx2, 4), _mm256_i32gather_ps(wi + (2 * p), idx2, 4), y2r, y2i);
+                    _mlx_cmul_avx2(u3r, u3i, _mm256_i32gather_ps(wr + (3 * p), idx3, 4), _mm256_i32gather_ps(wi + (3 * p), idx3, 4), y3r, y3i);
+
+                    _mlx_store4x8_avx2(dr + (4 * p), y0r, y1r, y2r, y3r);
+                    _mlx_store4x8_avx2(di + (4 * p), y0i, y1i, y2i, y3i);
+                }
+
+                _mlx_radix4_first(sr, si, dr, di, n1, p, wr, wi);
+                return;
+            }
+
+            // Odd Butterfly Count at Stride 4 (Length 16 only) and other Callers run scalar
+            if (((s == 4) && ((n1 % 2) != 0)) || ((s != 4) && ((s % 8) != 0)))
+            {
+                _mlx_radix4_stage(sr, si, dr, di, n1, s, wr, wi);
+                return;
+            }
+
+            if (s == 4)
+            {
+                for (size_t p = 0; p < n1; p += 2)
+                {
+                    const size_t t = p * s;
+                    const size_t t1 = t + s;
+
+                    const __m256 w1r = _mlx_broadcast2x4_avx2(wr + t, wr + t1), w1i = _mlx_broadcast2x4_avx2(wi + t, wi + t1);
+                    const __m256 w2r = _mlx_broadcast2x4_avx2(wr + (2 * t), wr + (2 * t1)), w2i = _mlx_broadcast2x4_avx2(wi + (2 * t), wi + (2 * t1));
+                    const __m256 w3r = _mlx_broadcast2x4_avx2(wr + (3 * t), wr + (3 * t1)), w3i = _mlx_broadcast2x4_avx2(wi + (3 * t), wi + (3 * t1));
+
+                    _mlx_butterfly4_avx2(
+                        _mm256_loadu_ps(sr + (s * p)), _mm256_loadu_ps(si + (s * p)),
+                        _mm256_loadu_ps(sr + (s * (p + n1))), _mm256_loadu_ps(si + (s * (p + n1))),
+                        _mm256_loadu_ps(sr + (s * (p + (2 * n1)))), _mm256_loadu_ps(si + (s * (p + (2 * n1)))),
+                        _mm256_loadu_ps(sr + (s * (p + (3 * n1)))), _mm256_loadu_ps(si + (s * (p + (3 * n1)))),
+                        y0r, y0i, u1r, u1i, u2r, u2i, u3r, u3i);
+
+                    _mlx_cmul_avx2(u1r, u1i, w1r, w1i, y1r, y1i);
+                    _mlx_cmul_avx2(u2r, u2i, w2r, w2i, y2r, y2i);
+                    _mlx_cmul_avx2(u3r, u3i, w3r, w3i, y3r, y3i);
+
+                    // Outputs of p at 4 s p, of p + 1 at 4 s (p + 1)
+                    float *o0r = dr + (s * (4 * p));
+                    float *o0i = di + (s * (4 * p));
+                    float *o1r = o0r + (4 * s);
+                    float *o1i = o0i + (4 * s);
+
+                    _mlx_store2x4_avx2(o0r, o1r, y0r);
+                    _mlx_store2x4_avx2(o0i, o1i, y0i);
+                    _mlx_store2x4_avx2(o0r + s, o1r + s, y1r);
+                    _mlx_store2x4_avx2(o0i + s, o1i + s, y1i);
+                    _mlx_store2x4_avx2(o0r + (2 * s), o1r + (2 * s), y2r);
+                    _mlx_store2x4_avx2(o0i + (2 * s), o1i + (2 * s), y2i);
+                    _mlx_store2x4_avx2(o0r + (3 * s), o1r + (3 * s), y3r);
+                    _mlx_store2x4_avx2(o0i + (3 * s), o1i + (3 * s), y3i);
+                }
+
+                return;
+            }
+
+            for (size_t p = 0; p < n1; p++)
+            {
+                const size_t t = p * s;
+
+                const __m256 w1r = _mm256_broadcast_ss(wr + t), w1i = _mm256_broadcast_ss(wi + t);
+                const __m256 w2r = _mm256_broadcast_ss(wr + (2 * t)), w2i = _mm256_broadcast_ss(wi + (2 * t));
+                const __m256 w3r = _mm256_broadcast_ss(wr + (3 * t)), w3i = _mm256_broadcast_ss(wi + (3 * t));
+
+                const float *ar_ = sr + (s * p);
+                const float *ai_ = si + (s * p);
+                const float *br_ = sr + (s * (p + n1));
+                const float *bi_ = si + (s * (p + n1));
+                const float *cr_ = sr + (s * (p + (2 * n1)));
+                const float *ci_ = si + (s * (p + (2 * n1)));
+                const float *er_ = sr + (s * (p + (3 * n1)));
+                const float *ei_ = si + (s * (p + (3 * n1)));
+
+                float *o0r = dr + (s * (4 * p));
+                float *o0i = di + (s * (4 * p));
+
+                for (size_t q = 0; q < s; q += 8)
+                {
+                    _mlx_butterfly4_avx2(
+                        _mm256_loadu_ps(ar_ + q), _mm256_loadu_ps(ai_ + q),
+                        _mm256_loadu_ps(br_ + q), _mm256_loadu_ps(bi_ + q),
+                        _mm256_loadu_ps(cr_ + q), _mm256_loadu_ps(ci_ + q),
+                        _mm256_loadu_ps(er_ + q), _mm256_loadu_ps(ei_ + q),
+                        y0r, y0i, u1r, u1i, u2r, u2i, u3r, u3i);
+
+                    _mlx_cmul_avx2(u1r, u1i, w1r, w1i, y1r, y1i);
+                    _mlx_cmul_avx2(u2r, u2i, w2r, w2i, y2r, y2i);
+                    _mlx_cmul_avx2(u3r, u3i, w3r, w3i, y3r, y3i);
+
+                    _mm256_storeu_ps(o0r + q, y0r);
+                    _mm256_storeu_ps(o0i + q, y0i);
+                    _mm256_storeu_ps(o0r + s + q, y1r);
+                    _mm256_storeu_ps(o0i + s + q, y1i);
+                    _mm256_storeu_ps(o0r + (2 * s) + q, y2r);
+                    _mm256_storeu_ps(o0i + (2 * s) + q, y2i);
+                    _mm256_storeu_ps(o0r + (3 * s) + q, y3r);
+                    _mm256_storeu_ps(o0i + (3 * s) + q, y3i);
+                }
+            }
+        }
+#endif
+
+
+        template <typename T>
+        class _native_workspace_t final : public MlxBasicRealFFTBackend<T>::Workspace
+        {
+        public:
+            _native_workspace_t(size_t half) : buf(4 * half) {};
+
+            // Real / Imaginary Part of Data and Stockham Partner Buffer
+            std::vector<T> buf;
+        };
+    }
+
+
+    template <typename T>
+    MlxBasicNativeComplexFFT<T>::MlxBasicNativeComplexFFT(size_t length)
+    : _length(length)
+    , _wr(length)
+    , _wi(length)
+    , _avx2(mlxCpuHasAvx2Fma())
+    {
+
+        for (size_t k = 0; k < _length; k++)
+        {
+            const double a = (2.0 * M_PI * k) / _length;
+            _wr[k] = T(cos(a));
+            _wi[k] = T(-sin(a));
+        }
+    }
+
+
+    template <typename T>
+    MlxBasicNativeComplexFFT<T>::~MlxBasicNativeComplexFFT()
+    {
+    }
+
+
+    template <typename T>
+    size_t MlxBasicNativeComplexFFT<T>::length() const
+    {
+        return _length;
+    }
+
+
+    template <typename T>
+    size_t MlxBasicNativeComplexFFT<T>::bytes() const
+    {
+        return sizeof(*this) + ((_wr.size() + _wi.size()) * sizeof(T));
+    }
+
+
+    template <typename T>
+    bool MlxBasicNativeComplexFFT<T>::supported(size_t length)
+    {
+        return (length > 0) && ((length & (length - 1)) == 0);
+    }
+
+
+    template <typename T>
+    void MlxBasicNativeComplexFFT<T>::transform(T *xr, T *xi, T *yr, T *yi, bool inverse) const
+    {
+        // conj(DFT(conj(x))) = swapped re / im Arrays in and out
+        if (inverse)
+        {
+            std::swap(xr, xi);
+            std::swap(yr, yi);
+        }
+
+        T *sr = xr, *si = xi;
+        T *dr = yr, *di = yi;
+
+        size_t n = _length;
+        size_t s = 1;
+
+        while (n >= 4)
+        {
+            const size_t n1 = n / 4;
+
+#ifdef MLX_X86_DISPATCH
+            if (_avx2)
+            {
+                _mlx_radix4_stage_avx2(sr, si, dr, di, n1, s, _wr.data(), _wi.data());
+            }
+            else
+#endif
+            {
+                _mlx_radix4_stage(sr, si, dr, di, n1, s, _wr.data(), _wi.data());
+            }
+
+            std::swap(sr, dr);
+            std::swap(si, di);
+
+            n /= 4;
+            s *= 4;
+        }
+
+        if (n == 2)
+        {
+            for (size_t q = 0; q < s; q++)
+            {
+                const T ar = sr[q], ai = si[q];
+                const T br = sr[q + s], bi = si[q + s];
+
+                dr[q] = ar + br;
+                di[q] = ai + bi;
+                dr[q + s] = ar - br;
+                di[q + s] = ai - bi;
+            }
+
+            std::swap(sr, dr);
+            std::swap(si, di);
+        }
+
+        if (sr != xr)
+        {
+            std::copy(sr, sr + _length, xr);
+            std::copy(si, si + _length, xi);
+        }
+    }
+
+
+
+    template <typename T>
+    MlxBasicNativeRealFFTBackend<T>::MlxBasicNativeRealFFTBackend(size_t length)
+    : _length(length)
+    , _half(length / 2)
+    , _fft(length / 2)
+    , _sr((length / 4) + 1)
+    , _si((length / 4) + 1)
+    {
+        for (size_t k = 0; k < _sr.size(); k++)
+        {
+            const double a = (2.0 * M_PI * k) / _length;
+            _sr[k] = T(cos(a));
+            _si[k] = T(-sin(a));
+        }
+    }
+
+
+    template <typename T>
+    MlxBasicNativeRealFFTBackend<T>::~MlxBasicNativeRealFFTBackend()
+    {
+    }
+
+
+    template <typename T>
+    size_t MlxBasicNativeRealFFTBackend<T>::length() const
+    {
+        return _length;
+    }
+
+
+    template <typename T>
+    size_t MlxBasicNativeRealFFTBackend<T>::bytes() const
+    {
+        return sizeof(*this) + _fft.bytes() + ((_sr.size() + _si.size()) * sizeof(T));
+    }
+
+
+    template <typename T>
+    FFTBackend_t MlxBasicNativeRealFFTBackend<T>::type() const
+    {
+        return MLX_FFT_BACKEND_NATIVE;
+    }
+
+
+    template <typename T>
+    std::unique_ptr<typename MlxBasicNativeRealFFTBackend<T>::Workspace> MlxBasicNativeRealFFTBackend<T>::createWorkspace() const
+    {
+        return std::make_unique<_native_workspace_t<T>>(_half);
+    }
+
+
+    template <typename T>
+    bool MlxBasicNativeRealFFTBackend<T>::transform(T *data, Workspace &ws) const
+    {
+        const size_t M = _half;
+        T *buf = static_cast<_native_workspace_t<T>&>(ws).buf.data();
+
+        T *zr = buf;
+        T *zi = buf + M;
+
+        // Pack: z[k] = x[2k] + i x[2k+1]
+        for (size_t k = 0; k < M; k++)
+        {
+            zr[k] = data[2 * k];
+            zi[k] = data[(2 * k) + 1];
+        }
+
+        _fft.transform(zr, zi, buf + (2 * M), buf + (3 * M));
+
+        /*
+         *  Split: with Fe = (Z[k] + Z*[M-k]) / 2 and Fo = (Z[k] - Z*[M-k]) / 2i
+         *  X[k] = Fe + W^k Fo and X[M-k] = (Fe - W^k Fo)*, W = exp(-2 pi i / N)
+         */
+        data[0] = zr[0] + zi[0];
+        data[_length - 1] = zr[0] - zi[0];
+
+        for (size_t k = 1; k <= (M / 2); k++)
+        {
+            const T ar = zr[k];
+            const T ai = zi[k];
+            const T cr = zr[M - k];
+            const T ci = zi[M - k];
+
+            const T fer = T(0.5) * (ar + cr);
+            const T fei = T(0.5) * (ai - ci);
+            const T for_ = T(0.5) * (ai + ci);
+            const T foi = -T(0.5) * (ar - cr);
+
+            const T tr = (_sr[k] * for_) - (_si[k] * foi);
+            const T ti = (_sr[k] * foi) + (_si[k] * for_);
+
+            data[(2 * k) - 1] = fer + tr;
+            data[2 * k] = fei + ti;
+
+            if (k != (M - k))
+            {
+                data[(2 * (M - k)) - 1] = fer - tr;
+                data[2 * (M - k)] = -(fei - ti);
+            }
+        }
+
+        return true;
+    }
+
+
+    template <typename T>
+    bool MlxBasicNativeRealFFTBackend<T>::inverse(T *data, Workspace &ws) const
+    {
+        const size_t M = _half;
+        T *buf = static_cast<_native_workspace_t<T>&>(ws).buf.data();
+
+        T *zr = buf;
+        T *zi = buf + M;
+
+        /*
+         *  Merge (Inverse of the Split): Fe = (X[k] + X*[M-k]) / 2, Fo = (X[k] - X*[M-k]) W^-k / 2
+         *  and Z[k] = Fe + i Fo; Fe, Fo are conjugate symmetric, so Z[M-k] = Fe* + i Fo*
+         */
+        const T x0 = data[0];
+        const T xm = data[_length - 1];
+
+        zr[0] = T(0.5) * (x0 + xm);
+        zi[0] = T(0.5) * (x0 - xm);
+
+        for (size_t k = 1; k <= (M / 2); k++)
+        {
+            const T ar = data[(2 * k) - 1];
+            const T ai = data[2 * k];
+            const T cr = (k != (M - k)) ? data[(2 * (M - k)) - 1] : ar;
+            const T ci = (k != (M - k)) ? data[2 * (M - k)] : ai;
+
+            const T fer = T(0.5) * (ar + cr);
+            const T fei = T(0.5) * (ai - ci);
+            const T dr = T(0.5) * (ar - cr);
+            const T di = T(0.5) * (ai + ci);
+
+            // Fo = D conj(W^k)
+            const T for_ = (dr * _sr[k]) + (di * _si[k]);
+            const T foi = (di * _sr[k]) - (dr * _si[k]);
+
+            zr[k] = fer - foi;
+            zi[k] = fei + for_;
+
+            if (k != (M - k))
+            {
+                zr[M - k] = fer + foi;
+                zi[M - k] = for_ - fei;
+            }
+        }
+
+        _fft.transform(zr, zi, buf + (2 * M), buf + (3 * M), true);
+
+        // Unpack: x[2n] = Re z[n], x[2n+1] = Im z[n]
+        const T scale = T(1.0 / M);
+
+        for (size_t k = 0; k < M; k++)
+        {
+            data[2 * k] = scale * zr[k];
+            data[(2 * k) + 1] = scale * zi[k];
+        }
+
+        return true;
+    }
+
+
+/// END - Native Backend
+
+
+
+/// Start - Bluestein Backend
+
+
+    template <typename T>
+    MlxBasicBluesteinRealFFTBackend<T>::MlxBasicBluesteinRealFFTBackend(size_t length)
+    : _length(length)
+    , _fftLength([length]() { size_t L = 1; while (L < ((2 * length) - 1)) L *= 2; return L; }())
+    , _fft(_fftLength)
+    , _wr(length)
+    , _wi(length)
+    , _br(_fftLength)
+    , _bi(_fftLength)
+    {
+        const size_t N = _length;
+        const size_t L = _fftLength;
+
+        // conj(w[m]) at m mod L in double, w is even in m
+        std::vector<double> br(L, 0.0);
+        std::vector<double> bi(L, 0.0);
+
+        // exp(-i pi m^2 / N) = exp(-i pi (m^2 mod 2N) / N), (m + 1)^2 = m^2 + 2m + 1 keeps r < 2N
+        size_t r = 0;
+
+        for (size_t m = 0; m < N; m++)
+        {
+            const double a = (M_PI * r) / N;
+            const double wr = cos(a);
+            const double wi = -sin(a);
+
+            _wr[m] = T(wr);
+            _wi[m] = T(wi);
+
+            br[m] = wr;
+            bi[m] = -wi;
+
+            if (m > 0)
+            {
+                br[L - m] = wr;
+                bi[L - m] = -wi;
+            }
+
+            r += (2 * m) + 1;
+            while (r >= (2 * N)) r -= 2 * N;
+        }
+
+        // Single Precision Backends take the Chirp Spectrum from a double Transform
+        std::vector<double> scratch(2 * L);
+
+        if constexpr (std::is_same<T, double>::value)
+        {
+            _fft.transform(br.data(), bi.data(), scratch.data(), scratch.data() + L);
+        }
+        else
+        {
+            MlxNativeComplexFFT(L).transform(br.data(), bi.data(), scratch.data(), scratch.data() + L);
+        }
+
+        // Inverse Scaling of the Convolution is folded into the Chirp Spectrum
+        for (size_t k = 0; k < L; k++)
+        {
+            _br[k] = T(br[k] / L);
+            _bi[k] = T(bi[k] / L);
+        }
+    }
+
+
+    template <typename T>
+    MlxBasicBluesteinRealFFTBackend<T>::~MlxBasicBluesteinRealFFTBackend()
+    {
+    }
+
+
+    template <typename T>
+    size_t MlxBasicBluesteinRealFFTBackend<T>::length() const
+    {
+        return _length;
+    }
+
+
+    template <typename T>
+    size_t MlxBasicBluesteinRealFFTBackend<T>::bytes() const
+    {
+        return sizeof(*this) + _fft.bytes() + ((_wr.size() + _wi.size() + _br.size() + _bi.size()) * sizeof(T));
+    }
+
+
+    template <typename T>
+    FFTBackend_t MlxBasicBluesteinRealFFTBackend<T>::type() const
+    {
+        return MLX_FFT_BACKEND_BLUESTEIN;
+    }
+
+
+    template <typename T>
+    std::unique_ptr<typename MlxBasicBluesteinRealFFTBackend<T>::Workspace> MlxBasicBluesteinRealFFTBackend<T>::createWorkspace() const
+    {
+        // [yr | yi | Stockham Partner], L each
+        return std::make_unique<_native_workspace_t<T>>(_fftLength);
+    }
+
+
+    /* X[k] = w[k] sum_n (x[n] w[n]) conj(w[k - n]) */
+    template <typename T>
+    bool MlxBasicBluesteinRealFFTBackend<T>::transform(T *data, Workspace &ws) const
+    {
+        const size_t N = _length;
+        const size_t L = _fftLength;
+        T *buf = static_cast<_native_workspace_t<T>&>(ws).buf.data();
+
+        T *yr = buf;
+        T *yi = buf + L;
+
+        for (size_t n = 0; n < N; n++)
+        {
+            yr[n] = data[n] * _wr[n];
+            yi[n] = data[n] * _wi[n];
+        }
+
+        std::fill(yr + N, yr + L, T(0));
+        std::fill(yi + N, yi + L, T(0));
+
+        _convolve(yr, yi, buf + (2 * L));
+
+        // Half Complex Output, Bins 0 ... N/2
+        data[0] = (yr[0] * _wr[0]) - (yi[0] * _wi[0]);
+
+        for (size_t k = 1; (2 * k) <= N; k++)
+        {
+            const T re = (yr[k] * _wr[k]) - (yi[k] * _wi[k]);
+            const T im = (yr[k] * _wi[k]) + (yi[k] * _wr[k]);
+
+            data[(2 * k) - 1] = re;
+            if ((2 * k) < N) data[2 * k] = im;
+        }
+
+        return true;
+    }
+
+
+    /* x = conj(DFT(conj(X))) / N with the Hermitian Spectrum X rebuilt from the Half Complex Data */
+    template <typename T>
+    bool MlxBasicBluesteinRealFFTBackend<T>::inverse(T *data, Workspace &ws) const
+    {
+        const size_t N = _length;
+        const size_t L = _fftLength;
+        T *buf = static_cast<_native_workspace_t<T>&>(ws).buf.data();
+
+        T *yr = buf;
+        T *yi = buf + L;
+
+        // y[n] = conj(X[n]) w[n]
+        yr[0] = data[0] * _wr[0];
+        yi[0] = data[0] * _wi[0];
+
+        for (size_t k = 1; (2 * k) <= N; k++)
+        {
+            const T xr = data[(2 * k) - 1];
+            const T xi = ((2 * k) < N) ? -data[2 * k] : T(0);
+
+            yr[k] = (xr * _wr[k]) - (xi * _wi[k]);
+            yi[k] = (xr * _wi[k]) + (xi * _wr[k]);
+
+            if ((N - k) != k)
+            {
+                // conj(X[N - k]) = X[k]
+                yr[N - k] = (xr * _wr[N - k]) + (xi * _wi[N - k]);
+                yi[N - k] = (xr * _wi[N - k]) - (xi * _wr[N - k]);
+            }
+        }
+
+        std::fill(yr + N, yr + L, T(0));
+        std::fill(yi + N, yi + L, T(0));
+
+        _convolve(yr, yi, buf + (2 * L));
+
+        const T scale = T(1.0 / N);
+
+        for (size_t n = 0; n < N; n++)
+        {
+            data[n] = scale * ((yr[n] * _wr[n]) - (yi[n] * _wi[n]));
+        }
+
+        return true;
+    }
+
+
+    template <typename T>
+    void MlxBasicBluesteinRealFFTBackend<T>::_convolve(T *yr, T *yi, T *scratch) const
+    {
+        const size_t L = _fftLength;
+
+        _fft.transform(yr, yi, scratch, scratch + L);
+
+        for (size_t k = 0; k < L; k++)
+        {
+            const T re = (yr[k] * _br[k]) - (yi[k] * _bi[k]);
+            const T im = (yr[k] * _bi[k]) + (yi[k] * _br[k]);
+
+            yr[k] = re;
+            yi[k] = im;
+        }
+
+        _fft.transform(yr, yi, scratch, scratch + L, true);
+    }
+
+
+/// END - Bluestein Backend
+
+
+    template class MlxBasicRealFFTBackend<double>;
+    template class MlxBasicRealFFTBackend<float>;
+
+    template class MlxBasicGslRealFFTBackend<double>;
+    template class MlxBasicGslRealFFTBackend<float>;
+
+    template class MlxBasicNativeComplexFFT<double>;
+    template class MlxBasicNativeComplexFFT<float>;
+
+    template class MlxBasicNativeRealFFTBackend<double>;
+    template class MlxBasicNativeRealFFTBackend<float>;
+
+    template class MlxBasicBluesteinRealFFTBackend<double>;
+    template class MlxBasicBluesteinRealFFTBackend<float>;
+
+
+}   /* namespace mlx */
@@ -0,0 +1,370 @@
+/**
+ * @file    mlx-fft-backend.h
+ * @brief   Exchangeable Real FFT Implementations (GSL mixed-radix, native power-of-two)
+ *          in double and single Precision
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
+
+
+namespace mlx
+{
+
+    typedef enum {
+        MLX_FFT_BACKEND_AUTO = 0,       // native for Powers of Two, Cost Model between GSL and Bluestein otherwise
+        MLX_FFT_BACKEND_GSL = 1,
+        MLX_FFT_BACKEND_NATIVE = 2,
+        MLX_FFT_BACKEND_BLUESTEIN = 3,
+    } FFTBackend_t;
+
+
+    /* Smallest Power of Two handled by the native Backend */
+    static const size_t MLX_FFT_NATIVE_MIN_LENGTH = 8;
+
+    /* Largest Prime Factor with a dedicated GSL Butterfly (real Transforms: 2, 3, 4, 5) */
+    static const size_t MLX_FFT_SMOOTH_RADIX = 5;
+
+    /*
+     *  Time per bluesteinCost() Unit over Time per gslCost() Unit (see MlxRealFFTBackend::select),
+     *  printed as fitted Weight by "mlx_fft_bench bluestein" (bench/mlx-fft-bench.cc)
+     */
+    static const double MLX_FFT_BLUESTEIN_WEIGHT = 4.0;
+
+
+    /**
+     * @brief   true if all Prime Factors are <= MLX_FFT_SMOOTH_RADIX
+     */
+    bool fftSmoothLength(size_t length);
+
+    /**
+     * @brief   Smallest 5-smooth Length >= length (Zero-Padding Target for awkward Lengths)
+     */
+    size_t fftFastLength(size_t length);
+
+
+    /**
+     * @brief   Forward Real FFT of one Length, Result in GSL Half Complex Layout
+     *
+     *  Backends are immutable after Construction and may be shared by all Threads.
+     *  Mutable Buffers live in a Workspace, one per Thread / Plan. T is the Sample
+     *  Type (double or float), Tables and Butterflies of a Backend run in T.
+     */
+    template <typename T>
+    class MlxBasicRealFFTBackend
+    {
+    public:
+
+        class Workspace
+        {
+        public:
+            virtual ~Workspace() {};
+        };
+
+
+        virtual ~MlxBasicRealFFTBackend() {};
+
+        virtual size_t length() const = 0;
+
+        /**
+         * @brief   Approximate Heap Size of the shared Tables
+         */
+        virtual size_t bytes() const = 0;
+
+        virtual FFTBackend_t type() const = 0;
+
+        virtual std::unique_ptr<Workspace> createWorkspace() const = 0;
+
+        /**
+         * @brief   In-place Transform of length() Samples
+         *
+         * @param data  Samples, replaced by Half Complex Coefficients
+         * @param ws    Workspace created by this Backend
+         * @return      false on Error
+         */
+        virtual bool transform(T *data, Workspace &ws) const = 0;
+
+        /**
+         * @brief   In-place inverse Transform, scaled by 1 / length()
+         *
+         * @param data  Half Complex Coefficients, replaced by Samples
+         * @param ws    Workspace created by this Backend
+         * @return      false on Error
+         */
+        virtual bool inverse(T *data, Workspace &ws) const = 0;
+
+
+        /**
+         * @brief   Create Backend for a Length
+         *
+         * @param length    Transform Length
+         * @param type      Requested Backend, falls back to GSL if native is not possible
+         */
+        static std::shared_ptr<const MlxBasicRealFFTBackend> create(size_t length, FFTBackend_t type = MLX_FFT_BACKEND_AUTO);
+
+        static bool nativeSupported(size_t length);
+
+        /**
+         * @brief   Backend chosen for AUTO: Bluestein if MLX_FFT_BLUESTEIN_WEIGHT bluesteinCost()
+         *          is below gslCost()
+         */
+        static FFTBackend_t select(size_t length);
+
+        /**
+         * @brief   GSL Cost Model: N (log2(N) + Sum of Prime Factors > MLX_FFT_SMOOTH_RADIX),
+         *          as larger Factors run through its generic O(p) Butterfly
+         */
+        static double gslCost(size_t length);
+
+        /**
+         * @brief   Bluestein Cost Model: L log2(L) with the Power of Two L >= 2 N - 1
+         */
+        static double bluesteinCost(size_t length);
+
+
+    };  /* MlxBasicRealFFTBackend */
+
+
+    typedef MlxBasicRealFFTBackend<double> MlxRealFFTBackend;
+    typedef MlxBasicRealFFTBackend<float> MlxRealFFTBackendFloat;
+
+
+
+    /* GSL Wavetables per Precision */
+    template <typename T> struct MlxGslFFTWavetables;
+
+    template <>
+    struct MlxGslFFTWavetables<double>
+    {
+        typedef gsl_fft_real_wavetable real_t;
+        typedef gsl_fft_halfcomplex_wavetable halfcomplex_t;
+    };
+
+    template <>
+    struct MlxGslFFTWavetables<float>
+    {
+        typedef gsl_fft_real_wavetable_float real_t;
+        typedef gsl_fft_halfcomplex_wavetable_float halfcomplex_t;
+    };
+
+
+    /**
+     * @brief   GSL mixed-radix Real FFT (any Length), gsl_fft_real_float_* for float
+     */
+    template <typename T>
+    class MlxBasicGslRealFFTBackend final : public MlxBasicRealFFTBackend<T>
+    {
+    public:
+
+        typedef typename MlxBasicRealFFTBackend<T>::Workspace Workspace;
+
+        MlxBasicGslRealFFTBackend(size_t length);
+        ~MlxBasicGslRealFFTBackend();
+
+        MlxBasicGslRealFFTBackend(const MlxBasicGslRealFFTBackend&) = delete;
+        void operator= (const MlxBasicGslRealFFTBackend&) = delete;
+
+
+        size_t length() const override;
+        size_t bytes() const override;
+        FFTBackend_t type() const override;
+
+        std::unique_ptr<Workspace> createWorkspace() const override;
+        bool transform(T *data, Workspace &ws) const override;
+        bool inverse(T *data, Workspace &ws) const override;
+
+
+    private:
+
+        const size_t _length;
+        typename MlxGslFFTWavetables<T>::real_t *_wvt;
+        typename MlxGslFFTWavetables<T>::halfcomplex_t *_hcWvt;
+
+
+    };  /* MlxBasicGslRealFFTBackend */
+
+
+    typedef MlxBasicGslRealFFTBackend<double> MlxGslRealFFTBackend;
+    typedef MlxBasicGslRealFFTBackend<float> MlxGslRealFFTBackendFloat;
+
+
+
+    /**
+     * @brief   Complex Stockham FFT for Powers of Two on split Arrays
+     *
+     *  Radix-4 Stages (one radix-2 Stage for odd Powers) with tabulated Twiddles.
+     *  Real and imaginary Parts are kept in separate Arrays, so the Butterflies run
+     *  on contiguous Data, one 256 Bit Vector at a time (four double / eight float)
+     *  with AVX2 / FMA Intrinsics where the CPU supports them. Twiddles are computed
+     *  in double and rounded to T once. Immutable, may be shared by all Threads.
+     */
+    template <typename T>
+    class MlxBasicNativeComplexFFT final
+    {
+    public:
+
+        MlxBasicNativeComplexFFT(size_t length);
+        ~MlxBasicNativeComplexFFT();
+
+
+        size_t length() const;
+        size_t bytes() const;
+
+        static bool supported(size_t length);
+
+
+        /**
+         * @brief   unscaled Transform, Result in (xr, xi)
+         *
+         * @param xr        Real Parts
+         * @param xi        Imaginary Parts
+         * @param yr        Scratch, length() Values
+         * @param yi        Scratch, length() Values
+         * @param inverse   exp(+2 pi i ...) Kernel (no 1/N Scaling)
+         */
+        void transform(T *xr, T *xi, T *yr, T *yi, bool inverse = false) const;
+
+
+    private:
+
+        const size_t _length;
+
+        // exp(-2 pi i k / N), k < N
+        std::vector<T> _wr;
+        std::vector<T> _wi;
+
+        // Butterflies with AVX2 / FMA Intrinsics (selected at Runtime)
+        bool _avx2;
+
+
+    };  /* MlxBasicNativeComplexFFT */
+
+
+    typedef MlxBasicNativeComplexFFT<double> MlxNativeComplexFFT;
+    typedef MlxBasicNativeComplexFFT<float> MlxNativeComplexFFTFloat;
+
+
+
+    /**
+     * @brief   Native Real FFT for Powers of Two
+     *
+     *  The N real Samples are packed into N/2 complex Values, transformed by
+     *  MlxBasicNativeComplexFFT and split into the Spectrum of the real Signal.
+     */
+    template <typename T>
+    class MlxBasicNativeRealFFTBackend final : public MlxBasicRealFFTBackend<T>
+    {
+    public:
+
+        typedef typename MlxBasicRealFFTBackend<T>::Workspace Workspace;
+
+        MlxBasicNativeRealFFTBackend(size_t length);
+        ~MlxBasicNativeRealFFTBackend();
+
+
+        size_t length() const override;
+        size_t bytes() const override;
+        FFTBackend_t type() const override;
+
+        std::unique_ptr<Workspace> createWorkspace() const override;
+        bool transform(T *data, Workspace &ws) const override;
+        bool inverse(T *data, Workspace &ws) const override;
+
+
+    private:
+
+        const size_t _length;
+        const size_t _half;
+
+        // Transform of the packed Samples, length N/2
+        MlxBasicNativeComplexFFT<T> _fft;
+
+        // exp(-2 pi i k / N), k <= N/4 - Split of the packed Spectrum
+        std::vector<T> _sr;
+        std::vector<T> _si;
+
+
+    };  /* MlxBasicNativeRealFFTBackend */
+
+
+    typedef MlxBasicNativeRealFFTBackend<double> MlxNativeRealFFTBackend;
+    typedef MlxBasicNativeRealFFTBackend<float> MlxNativeRealFFTBackendFloat;
+
+
+
+
+    /**
+     * @brief   Bluestein Real FFT for Lengths with large Prime Factors
+     *
+     *  The DFT is rewritten with nk = (n^2 + k^2 - (k - n)^2) / 2 as Convolution with the
+     *  Chirp exp(i pi m^2 / N), evaluated by MlxBasicNativeComplexFFT of the Power of Two
+     *  L >= 2 N - 1. Chirp Phases use m^2 mod 2N in Integers, so they are exact for any N.
+     *  Cost is O(N log N) for every Length, independent of its Factorization. The Chirp
+     *  Spectrum is computed in double for both Precisions.
+     */
+    template <typename T>
+    class MlxBasicBluesteinRealFFTBackend final : public MlxBasicRealFFTBackend<T>
+    {
+    public:
+
+        typedef typename MlxBasicRealFFTBackend<T>::Workspace Workspace;
+
+        MlxBasicBluesteinRealFFTBackend(size_t length);
+        ~MlxBasicBluesteinRealFFTBackend();
+
+
+        size_t length() const override;
+        size_t bytes() const override;
+        FFTBackend_t type() const override;
+
+        std::unique_ptr<Workspace> createWorkspace() const override;
+        bool transform(T *data, Workspace &ws) const override;
+        bool inverse(T *data, Workspace &ws) const override;
+
+
+    private:
+
+        /* (yr, yi) of N Values (zero-padded to L) -> Chirp Convolution in place */
+        void _convolve(T *yr, T *yi, T *scratch) const;
+
+        const size_t _length;
+        const size_t _fftLength;
+
+        MlxBasicNativeComplexFFT<T> _fft;
+
+        // Chirp w[n] = exp(-i pi n^2 / N), n < N
+        std::vector<T> _wr;
+        std::vector<T> _wi;
+
+        // Spectrum of the circular conj(w[m]), m = -(N - 1) ... N - 1
+        std::vector<T> _br;
+        std::vector<T> _bi;
+
+
+    };  /* MlxBasicBluesteinRealFFTBackend */
+
+
+    typedef MlxBasicBluesteinRealFFTBackend<double> MlxBluesteinRealFFTBackend;
+    typedef MlxBasicBluesteinRealFFTBackend<float> MlxBluesteinRealFFTBackendFloat;
+
+
+}   /* namespace mlx */
@@ -0,0 +1,124 @@
+/**
+ * @file    mlx-fft-batch.cc
+ * @brief   Batched Real FFT over equal-length Frames
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-fft-batch.h"
+
+#include <atomic>
+#include <algorithm>
+
+
+namespace mlx
+{
+
+    MlxBatchRealFFT::MlxBatchRealFFT(size_t length, MlxThreadPool &pool, MlxFFTPlanCache &cache)
+    : _length(length)
+    , _pool(pool)
+    , _cache(cache)
+    {
+    }
+
+
+    MlxBatchRealFFT::~MlxBatchRealFFT()
+    {
+    }
+
+
+    size_t MlxBatchRealFFT::length() const
+    {
+        return _length;
+    }
+
+
+    size_t MlxBatchRealFFT::psdLength() const
+    {
+        return (_length == 0) ? 0 : ((_length / 2) + 1);
+    }
+
+
+    bool MlxBatchRealFFT::magnitude(const double *frames, size_t count, double *out)
+    {
+        return _run(frames, count, out, _length, &MlxMixedRadixRealFFT::normalizedMagnitude);
+    }
+
+
+    bool MlxBatchRealFFT::powerSpectrum(const double *frames, size_t count, double *out)
+    {
+        return _run(frames, count, out, psdLength(), &MlxMixedRadixRealFFT::pwrSpectralDensity);
+    }
+
+
+    std::shared_ptr<MlxFixedMatrix<double>> MlxBatchRealFFT::magnitude(const MlxFixedMatrix<double> &frames)
+    {
+        if (frames.cols() != _length) return nullptr;
+
+        std::shared_ptr<MlxFixedMatrix<double>> res = std::make_shared<MlxFixedMatrix<double>>(frames.rows(), _length);
+        if (!magnitude(frames.data(), frames.rows(), res->data())) return nullptr;
+
+        return res;
+    }
+
+
+    std::shared_ptr<MlxFixedMatrix<double>> MlxBatchRealFFT::powerSpectrum(const MlxFixedMatrix<double> &frames)
+    {
+        if (frames.cols() != _length) return nullptr;
+
+        std::shared_ptr<MlxFixedMatrix<double>> res = std::make_shared<MlxFixedMatrix<double>>(frames.rows(), psdLength());
+        if (!powerSpectrum(frames.data(), frames.rows(), res->data())) return nullptr;
+
+        return res;
+    }
+
+
+    bool MlxBatchRealFFT::_run(const double *frames, size_t count, double *out, size_t outLength, _kernel_t kernel)
+    {
+        if ((count == 0) || (_length == 0)) return true;
+
+        // Contiguous Blocks keep each Worker streaming through its own Part of the Matrix
+        const size_t workers = (count < MLX_FFT_BATCH_MIN_PARALLEL) ? 1 : std::min(_pool.size(), count);
+        const size_t block = (count + workers - 1) / workers;
+
+        std::atomic<bool> ok { true };
+
+        auto work = [&](size_t w)
+        {
+            const size_t first = w * block;
+            const size_t last = std::min(count, first + block);
+            if (first >= last) return;
+
+            std::shared_ptr<MlxMixedRadixRealFFT> plan = _cache.acquire(_length);
+
+            for (size_t f = first; f < last; f++)
+            {
+                if (!((*plan).*kernel)(frames + (f * _length), out + (f * outLength)))
+                {
+                    ok.store(false, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        if (workers == 1)
+        {
+            work(0);
+        }
+        else
+        {
+            _pool.parallelFor(workers, work);
+        }
+
+        return ok.load();
+    }
+
+
+}   /* namespace mlx */
@@ -0,0 +1,102 @@
+/**
+ * @file    mlx-fft-batch.h
+ * @brief   Batched Real FFT over equal-length Frames
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <memory>
+
+#include "structures/mlx-matrix.h"
+#include "mlx-fft-plan-cache.h"
+#include "mlx-thread-pool.h"
+
+
+namespace mlx
+{
+
+    /* Frames below this Count are transformed on the calling Thread */
+    static const size_t MLX_FFT_BATCH_MIN_PARALLEL = 4;
+
+
+    /**
+     * @brief   Transforms many Frames of one Length
+     *
+     *  All Frames share one Wavetable from the Plan Cache. The Batch is split into
+     *  contiguous Blocks of Frames across the Thread Pool, every Worker uses its own
+     *  thread-local Plan (Workspace and Scratch).
+     */
+    class MlxBatchRealFFT
+    {
+    public:
+
+        /**
+         * @brief   Create Batch Transformation
+         *
+         * @param length    Frame Length
+         * @param pool      Worker Threads
+         * @param cache     Plan Cache
+         */
+        MlxBatchRealFFT(size_t length, MlxThreadPool &pool = MlxThreadPool::global(), MlxFFTPlanCache &cache = MlxFFTPlanCache::global());
+        ~MlxBatchRealFFT();
+
+
+        size_t length() const;
+
+        /**
+         * @brief   Number of Values per Power Spectrum (DC ... Nyquist)
+         */
+        size_t psdLength() const;
+
+
+        /**
+         * @brief   Normalized Magnitudes (Layout as MlxMixedRadixRealFFT::normalizedMagnitude)
+         *
+         * @param frames    count x length() Samples
+         * @param count     Number of Frames
+         * @param out       count x length() Values
+         * @return          false on Error
+         */
+        bool magnitude(const double *frames, size_t count, double *out);
+
+        /**
+         * @brief   Power Spectra (Layout as MlxMixedRadixRealFFT::pwrSpectralDensity)
+         *
+         * @param frames    count x length() Samples
+         * @param count     Number of Frames
+         * @param out       count x psdLength() Values
+         * @return          false on Error
+         */
+        bool powerSpectrum(const double *frames, size_t count, double *out);
+
+
+        std::shared_ptr<MlxFixedMatrix<double>> magnitude(const MlxFixedMatrix<double> &frames);
+        std::shared_ptr<MlxFixedMatrix<double>> powerSpectrum(const MlxFixedMatrix<double> &frames);
+
+
+    protected:
+
+        typedef bool (MlxMixedRadixRealFFT::*_kernel_t)(const double*, double*);
+
+        bool _run(const double *frames, size_t count, double *out, size_t outLength, _kernel_t kernel);
+
+        const size_t _length;
+        MlxThreadPool &_pool;
+        MlxFFTPlanCache &_cache;
+
+
+    };  /* MlxBatchRealFFT */
+
+
+}   /* namespace mlx */
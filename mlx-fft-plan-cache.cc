@@ -0,0 +1,212 @@
+/**
+ * @file    mlx-fft-plan-cache.cc
+ * @brief   Thread-safe, bounded Cache of Real FFT Plans
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-fft-plan-cache.h"
+
+#include <vector>
+
+
+namespace mlx
+{
+
+    namespace
+    {
+        struct _thread_plan_t
+        {
+            uint64_t cache;
+            size_t length;
+            uint64_t epoch;
+            std::shared_ptr<MlxMixedRadixRealFFT> plan;
+        };
+
+        // Plans of the current Thread, most recent first
+        thread_local std::vector<_thread_plan_t> _mlx_thread_plans;
+
+        std::atomic<uint64_t> _mlx_cache_ids { 1 };
+    }
+
+
+    MlxFFTPlanCache::MlxFFTPlanCache(size_t capacity)
+    : _id(_mlx_cache_ids.fetch_add(1))
+    , _capacity(capacity)
+    , _bytes(0)
+    , _epoch(0)
+    , _hits(0)
+    , _misses(0)
+    , _evictions(0)
+    {
+    }
+
+
+    MlxFFTPlanCache::~MlxFFTPlanCache()
+    {
+    }
+
+
+    MlxFFTPlanCache& MlxFFTPlanCache::global()
+    {
+        static MlxFFTPlanCache cache;
+        return cache;
+    }
+
+
+    std::shared_ptr<MlxMixedRadixRealFFT> MlxFFTPlanCache::acquire(size_t length, bool allowPadding)
+    {
+        if (length == 0) return nullptr;
+
+        if (allowPadding && !MlxRealFFTBackend::nativeSupported(length)) length = fftFastLength(length);
+
+        std::vector<_thread_plan_t> &plans = _mlx_thread_plans;
+        const uint64_t epoch = _epoch.load(std::memory_order_acquire);
+
+        for (size_t k = 0; k < plans.size(); k++)
+        {
+            if ((plans[k].cache != _id) || (plans[k].length != length)) continue;
+
+            if (plans[k].epoch != epoch)
+            {
+                // Something was evicted since - check the Wavetable is still the shared one
+                _wavetable_t wvt = _getWavetable(length);
+
+                if (wvt.get() != plans[k].plan->backend().get())
+                {
+                    plans[k].plan = std::make_shared<MlxMixedRadixRealFFT>(wvt);
+                }
+
+                plans[k].epoch = epoch;
+            }
+            else
+            {
+                _hits.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            if (k > 0) std::swap(plans[0], plans[k]);
+            return plans[0].plan;
+        }
+
+        _thread_plan_t entry { _id, length, epoch, std::make_shared<MlxMixedRadixRealFFT>(_getWavetable(length)) };
+
+        if (plans.size() >= MLX_FFT_PLAN_CACHE_THREAD_ENTRIES) plans.pop_back();
+        plans.insert(plans.begin(), entry);
+
+        return entry.plan;
+    }
+
+
+    size_t MlxFFTPlanCache::capacity() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _capacity;
+    }
+
+
+    void MlxFFTPlanCache::setCapacity(size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _capacity = bytes;
+        _evict();
+    }
+
+
+    MlxFFTPlanCacheStats MlxFFTPlanCache::stats() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        return MlxFFTPlanCacheStats {
+            _hits.load(std::memory_order_relaxed),
+            _misses.load(std::memory_order_relaxed),
+            _evictions.load(std::memory_order_relaxed),
+            _tables.size(),
+            _bytes
+        };
+    }
+
+
+    void MlxFFTPlanCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _tables.clear();
+        _lru.clear();
+        _bytes = 0;
+
+        _epoch.fetch_add(1, std::memory_order_release);
+    }
+
+
+    MlxFFTPlanCache::_wavetable_t MlxFFTPlanCache::_getWavetable(size_t length)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            if (auto search = _tables.find(length); search != _tables.end())
+            {
+                _lru.splice(_lru.begin(), _lru, search->second.lru);
+                _hits.fetch_add(1, std::memory_order_relaxed);
+
+                return search->second.wavetable;
+            }
+        }
+
+        // Compute outside the Lock, other Lengths stay available meanwhile
+        _wavetable_t wvt = MlxRealFFTBackend::create(length);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (auto search = _tables.find(length); search != _tables.end())
+        {
+            // Another Thread was faster
+            _lru.splice(_lru.begin(), _lru, search->second.lru);
+            _hits.fetch_add(1, std::memory_order_relaxed);
+
+            return search->second.wavetable;
+        }
+
+        _misses.fetch_add(1, std::memory_order_relaxed);
+
+        _lru.push_front(length);
+        _tables.insert(std::make_pair(length, _entry_t { wvt, _lru.begin() }));
+        _bytes += wvt->bytes();
+
+        _evict();
+
+        return wvt;
+    }
+
+
+    /* Caller holds _mutex. The most recent Entry is kept even if it exceeds the Capacity */
+    void MlxFFTPlanCache::_evict()
+    {
+        bool evicted = false;
+
+        while ((_bytes > _capacity) && (_lru.size() > 1))
+        {
+            const size_t length = _lru.back();
+            auto search = _tables.find(length);
+
+            _bytes -= search->second.wavetable->bytes();
+            _tables.erase(search);
+            _lru.pop_back();
+
+            _evictions.fetch_add(1, std::memory_order_relaxed);
+            evicted = true;
+        }
+
+        if (evicted) _epoch.fetch_add(1, std::memory_order_release);
+    }
+
+
+}   /* namespace mlx */
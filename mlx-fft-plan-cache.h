@@ -0,0 +1,134 @@
+/**
+ * @file    mlx-fft-plan-cache.h
+ * @brief   Thread-safe, bounded Cache of Real FFT Plans
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <unordered_map>
+
+#include "mlx-fft.h"
+
+
+namespace mlx
+{
+
+    /* Default Bound of the shared Wavetables */
+    static const size_t MLX_FFT_PLAN_CACHE_CAPACITY = 32 * 1024 * 1024;
+
+    /* Plans (Wavetable Reference + Workspace) kept per Thread and Cache */
+    static const size_t MLX_FFT_PLAN_CACHE_THREAD_ENTRIES = 8;
+
+
+    struct MlxFFTPlanCacheStats
+    {
+        uint64_t hits;          // Plan found (Thread Cache or shared Wavetable)
+        uint64_t misses;        // Wavetable had to be computed
+        uint64_t evictions;     // Wavetables dropped by the Capacity Bound
+        size_t entries;         // shared Wavetables
+        size_t bytes;           // Size of the shared Wavetables
+    };
+
+
+    /**
+     * @brief   Hands out Real FFT Plans per Length
+     *
+     *  Wavetables (Backends, see MlxRealFFTBackend) are immutable and shared by all
+     *  Threads, each Thread gets its own Plan (Workspace) on top of it. A Lookup on a Thread that used the Length before
+     *  takes no Lock. The shared Wavetables are bounded in Bytes with LRU Eviction by
+     *  shared Lookups; a Plan still held by a Thread keeps its Wavetable alive until
+     *  the Thread notices the Eviction at its next Lookup.
+     */
+    class MlxFFTPlanCache final
+    {
+    public:
+
+        MlxFFTPlanCache(size_t capacity = MLX_FFT_PLAN_CACHE_CAPACITY);
+        ~MlxFFTPlanCache();
+
+        MlxFFTPlanCache(const MlxFFTPlanCache&) = delete;
+        void operator= (const MlxFFTPlanCache&) = delete;
+
+
+        /**
+         * @brief   Get the calling Thread's Plan for a Length
+         *
+         *  The Plan must only be used on the calling Thread. Lengths with large Prime
+         *  Factors get a Bluestein Plan; if the Caller can zero-pad (Spectra only, Bins
+         *  move to fs / plan->length()), allowPadding returns the Plan of the next
+         *  5-smooth Length instead, which is cheaper still.
+         *
+         * @param length        Transform Length
+         * @param allowPadding  Plan may be longer than length, check plan->length()
+         * @return              Plan, nullptr for Length 0
+         */
+        std::shared_ptr<MlxMixedRadixRealFFT> acquire(size_t length, bool allowPadding = false);
+
+
+        size_t capacity() const;
+        void setCapacity(size_t bytes);
+
+        MlxFFTPlanCacheStats stats() const;
+
+        /**
+         * @brief   Drop all shared Wavetables (Thread Plans are rebuilt on next Lookup)
+         *
+         */
+        void clear();
+
+
+        /**
+         * @brief   Cache shared by the Library
+         */
+        static MlxFFTPlanCache& global();
+
+
+    private:
+
+        typedef std::shared_ptr<const MlxRealFFTBackend> _wavetable_t;
+
+        struct _entry_t
+        {
+            _wavetable_t wavetable;
+            std::list<size_t>::iterator lru;
+        };
+
+        _wavetable_t _getWavetable(size_t length);
+        void _evict();
+
+        const uint64_t _id;
+
+        mutable std::mutex _mutex;
+        std::unordered_map<size_t, _entry_t> _tables;
+        std::list<size_t> _lru;    // most recent first
+        size_t _capacity;
+        size_t _bytes;
+
+        // Incremented whenever a Wavetable leaves the shared Table
+        std::atomic<uint64_t> _epoch;
+
+        std::atomic<uint64_t> _hits;
+        std::atomic<uint64_t> _misses;
+        std::atomic<uint64_t> _evictions;
+
+
+    };  /* MlxFFTPlanCache */
+
+
+}   /* namespace mlx */
@@ -1,8 +1,10 @@
 
 
 #include "mlx-fft.h"
+#include "mlx-complex-fft.h"
 
 #include <math.h>
+#include <algorithm>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_fft_complex.h>
 
@@ -14,6 +16,28 @@
 
 namespace mlx {
 
+    size_t spectralBandCount(size_t bins, double binWidth, double df)
+    {
+        if ((bins == 0) || (binWidth <= 0.0) || (df <= 0.0)) return 0;
+
+        return size_t(floor((((bins - 1) * binWidth) / df) + 0.5)) + 1;
+    }
+
+
+    void integrateSpectralBands(const double *values, size_t bins, double binWidth, double df, double scale, double *bands)
+    {
+        const size_t B = spectralBandCount(bins, binWidth, df);
+        std::fill(bands, bands + B, 0.0);
+
+        for (size_t k = 0; k < bins; k++)
+        {
+            const size_t b = std::min(B - 1, size_t(floor(((k * binWidth) / df) + 0.5)));
+            bands[b] += scale * values[k];
+        }
+    }
+
+
+
     MlxFastFourrierProcessor::MlxFastFourrierProcessor()
     {}
 
@@ -60,18 +84,23 @@ namespace mlx {
 
 
 
-    MlxMixedRadixRealFFT::MlxMixedRadixRealFFT(size_t length)
-    : _length(length)
-    , _wvt(gsl_fft_real_wavetable_alloc(length))
-    , _wrk(gsl_fft_real_workspace_alloc(length))
+    MlxMixedRadixRealFFT::MlxMixedRadixRealFFT(size_t length, FFTBackend_t type)
+    : MlxMixedRadixRealFFT(MlxRealFFTBackend::create(length, type))
+    {
+    }
+
+
+    MlxMixedRadixRealFFT::MlxMixedRadixRealFFT(std::shared_ptr<const MlxRealFFTBackend> backend)
+    : _length(backend->length())
+    , _backend(backend)
+    , _wrk(backend->createWorkspace())
+    , _scratch(backend->length())
     {
     }
 
 
     MlxMixedRadixRealFFT::~MlxMixedRadixRealFFT()
     {
-        gsl_fft_real_wavetable_free(_wvt);
-        gsl_fft_real_workspace_free(_wrk);
     }
 
 
@@ -81,38 +110,97 @@ namespace mlx {
     }
 
 
-    std::shared_ptr<MlxFixedVector<double>> MlxMixedRadixRealFFT::normalizedMagnitude(MlxFixedVector<double> &signal)
+    const std::shared_ptr<const MlxRealFFTBackend>& MlxMixedRadixRealFFT::backend() const
     {
+        return _backend;
+    }
 
-        gsl_vector* inp = signal.toGslVector();
 
-        // Generate the Half Complex Coeffs
-        gsl_fft_real_transform(inp->data, 1, inp->size, _wvt, _wrk);
+    bool MlxMixedRadixRealFFT::transform(double *data)
+    {
+        return _backend->transform(data, *_wrk);
+    }
 
-        // **2 for all Vector Elements
-        gsl_vector_mul(inp, inp);
 
+    bool MlxMixedRadixRealFFT::inverse(double *data)
+    {
+        if (_length == 0) return true;
 
-        std::shared_ptr<MlxFixedVector<double>> res = std::make_shared<MlxFixedVector<double>>(inp->size);
+        return _backend->inverse(data, *_wrk);
+    }
 
-        size_t i = 1;
-        double factor = 2.0 / inp->size; /// (inp->size * inp->size);
-        
-        double val = factor * inp->data[0]; ///(inp->data[0] * inp->data[0]);
-        res->set(0, val);
-        res->set(res->size()-1, val);
-        
-        for (size_t n = 1; n < inp->size; n += 2)
-        {
-            val = factor * sqrt(inp->data[n] + inp->data[n+1]);
 
-            res->set(i,val);
-            res->set(inp->size - (1+i), val);
+    bool MlxMixedRadixRealFFT::spectralFilter(double *data, const double *gain)
+    {
+        const size_t N = _length;
+        if (N == 0) return true;
+
+        if (!_backend->transform(data, *_wrk)) return false;
 
-            i++;
+        // Half Complex: Bin k at (2k - 1, 2k), Nyquist of even Lengths at N - 1 only
+        data[0] *= gain[0];
+        for (size_t n = 1; n < N; n++) data[n] *= gain[(n + 1) / 2];
+
+        return _backend->inverse(data, *_wrk);
+    }
+
+
+    bool MlxMixedRadixRealFFT::spectralFilter(double *data, const MlxComplexVector &transfer)
+    {
+        const size_t N = _length;
+        if (N == 0) return true;
+        if (transfer.size() < psdLength()) return false;
+
+        if (!_backend->transform(data, *_wrk)) return false;
+
+        const bool split = (transfer.layout() == MLX_COMPLEX_SPLIT);
+        const double *hr = split ? transfer.real() : transfer.data();
+        const double *hi = split ? transfer.imag() : (transfer.data() + 1);
+        const size_t step = split ? 1 : 2;
+
+        data[0] *= hr[0];
+
+        for (size_t k = 1; (2 * k) < N; k++)
+        {
+            const double re = data[(2 * k) - 1];
+            const double im = data[2 * k];
+            const double tr = hr[k * step];
+            const double ti = hi[k * step];
+
+            data[(2 * k) - 1] = (re * tr) - (im * ti);
+            data[2 * k] = (re * ti) + (im * tr);
         }
 
-        gsl_vector_free(inp);
+        if ((N % 2) == 0) data[N - 1] *= hr[(N / 2) * step];
+
+        return _backend->inverse(data, *_wrk);
+    }
+
+
+    bool MlxMixedRadixRealFFT::spectralFilter(double *data, const std::function<void(double*, size_t)> &fn)
+    {
+        if (_length == 0) return true;
+
+        if (!_backend->transform(data, *_wrk)) return false;
+
+        fn(data, _length);
+
+        return _backend->inverse(data, *_wrk);
+    }
+
+
+    std::shared_ptr<MlxFixedVector<double>> MlxMixedRadixRealFFT::normalizedMagnitude(MlxFixedVector<double> &signal)
+    {
+        std::shared_ptr<MlxFixedVector<double>> res = std::make_shared<MlxFixedVector<double>>(_length);
+        if (_length == 0) return res;
+
+        // Shorter Signals are zero-padded to the Plan Length
+        for (size_t k = 0; k < _length; k++) _scratch[k] = (k < signal.size()) ? signal.at(k) : 0.0;
+
+        if (_transformScratch())
+        {
+            _magnitudeFromScratch(&(*res)[0]);
+        }
 
         return res;
     }
@@ -120,86 +208,228 @@ namespace mlx {
 
     std::shared_ptr<MlxFixedVector<double>> MlxMixedRadixRealFFT::pwrSpectralDensity(MlxFixedVector<double> &signal, const double fs, const double df)
     {
+        const size_t B = psdLength();
+        const double binWidth = (_length > 0) ? (fs / _length) : 0.0;
+        const size_t bands = spectralBandCount(B, binWidth, df);
 
-        gsl_vector* inp = signal.toGslVector();
+        std::shared_ptr<MlxFixedVector<double>> res = std::make_shared<MlxFixedVector<double>>((bands > 0) ? bands : B);
+        if (_length == 0) return res;
 
-        // Generate the Half Complex Coeffs
-        gsl_fft_real_transform(inp->data, 1, inp->size, _wvt, _wrk);
+        for (size_t k = 0; k < _length; k++) _scratch[k] = (k < signal.size()) ? signal.at(k) : 0.0;
 
-        // **2 for all Vector Elements
-        gsl_vector_mul(inp, inp);
-       
+        if (!_transformScratch()) return res;
 
-        // double sr = fs / (2.0 * signal.size());
+        if (bands == 0)
+        {
+            _powerFromScratch(&(*res)[0]);
+        }
+        else
+        {
+            // Bin Powers overwrite the Coefficients in place (Bin i only reads Coefficients >= i)
+            _powerFromScratch(_scratch.data());
+            integrateSpectralBands(_scratch.data(), B, binWidth, df, 1.0, &(*res)[0]);
+        }
+
+        return res;
+    }
+
+
+    bool MlxMixedRadixRealFFT::normalizedMagnitude(const double *in, double *out)
+    {
+        if (_length == 0) return true;
 
-        // size_t ns = size_t (0.5 * df / sr);
-        // size_t ne = size_t (1.5 * df / sr);
+        std::copy(in, in + _length, _scratch.begin());
+        if (!_transformScratch()) return false;
 
-        // if ((ns * sr) < (df * 0.5)) ns++;
-        
-        // if ((ne * sr) >= (df * 1.5)) ne--;
+        _magnitudeFromScratch(out);
+        return true;
+    }
 
-        // std::cout << "start: " << ns << "(" << ns * sr << ")" << "\n";
-        // std::cout << "end " << ne << "(" << ne * sr << ")\n";
 
-        // size_t i = 1;
+    bool MlxMixedRadixRealFFT::pwrSpectralDensity(const double *in, double *out)
+    {
+        if (_length == 0) return true;
 
-        double factor = 2.0 / (inp->size); // * inp->size); /// (inp->size * inp->size);
-        double val = 0 ; //factor * inp->data[0]; ///(inp->data[0] * inp->data[0]);
-        // res->set(0, val);
-        // res->set(res->size()-1, val);
+        std::copy(in, in + _length, _scratch.begin());
+        if (!_transformScratch()) return false;
+
+        _powerFromScratch(out);
+        return true;
+    }
 
-        std::vector<double> integ;
 
-        integ.push_back(factor * inp->data[0]);
+    bool MlxMixedRadixRealFFT::normalizedMagnitude(const std::vector<double> &in, std::vector<double> &out)
+    {
+        if (in.size() < _length) return false;
+        if (out.size() != _length) out.resize(_length);
+
+        return normalizedMagnitude(in.data(), out.data());
+    }
+
 
-        for (size_t n = 1; n < inp->size; n += 2)
+    bool MlxMixedRadixRealFFT::pwrSpectralDensity(const std::vector<double> &in, std::vector<double> &out)
+    {
+        if (in.size() < _length) return false;
+        if (out.size() != psdLength()) out.resize(psdLength());
+
+        return pwrSpectralDensity(in.data(), out.data());
+    }
+
+
+    bool MlxMixedRadixRealFFT::spectrum(const double *in, MlxComplexVector &out)
+    {
+        if (_length == 0)
         {
-            val = factor * abs(inp->data[n] + inp->data[n + 1]);
-            integ.push_back(val);
-        }   
+            out.resize(0);
+            return true;
+        }
 
-        // while (ns < inp->size)
-        // {
+        std::copy(in, in + _length, _scratch.begin());
+        if (!_transformScratch()) return false;
 
-        //     n = 0;
-        //     val = 0;
+        unpackHalfComplex(_scratch.data(), _length, out);
+        return true;
+    }
 
-        //     while ((( n * sr ) < (df * 1.5)) && (ns + n) < inp->size)
-        //     {
-        //         val += factor * sqrt(inp->data[ns + n] + inp->data[ns + n + 1]);
-        //         n += 2;
-        //     }
 
-        //     integ.push_back(val);
-        //     std::cout << "ns: " << ns << " \tne: " << ns + n << "\t" << val << "\n";
+    size_t MlxMixedRadixRealFFT::psdLength() const
+    {
+        return (_length == 0) ? 0 : ((_length / 2) + 1);
+    }
 
-        //     ns += (n + 1);
 
-        //     for (size_t n = ns; n <= (ne * i); n += 2)
-        //     {
-        //         val += factor * sqrt(inp->data[n] + inp->data[n+1]);
-        //     }
-            
+    bool MlxMixedRadixRealFFT::_transformScratch()
+    {
+        return _backend->transform(_scratch.data(), *_wrk);
+    }
 
-        //     ns = (ne * i) + 1;
 
-        //     integ.push_back(val);
+    /* Half Complex Coefficients -> mirrored normalized Magnitude, squared and rooted in one Pass */
+    void MlxMixedRadixRealFFT::_magnitudeFromScratch(double *out) const
+    {
+        const size_t N = _length;
+        const double *d = _scratch.data();
+        const double factor = 2.0 / N;
 
-        // // }
-        // // for (size_t n = 1; n < inp->size; n += 2)
-        // // {
+        double val = factor * (d[0] * d[0]);
+        out[0] = val;
+        out[N - 1] = val;
 
+        size_t i = 1;
 
-        //     //val = factor * (inp->data[n] + inp->data[n+1]);
+        for (size_t n = 1; n < N; n += 2)
+        {
+            // Nyquist Term of even Lengths has no imaginary Part
+            const double re = d[n];
+            const double im = ((n + 1) < N) ? d[n + 1] : 0.0;
 
-        //     //res->set(i,val);
-        //     //res->set(inp->size - (1+i), val);
+            val = factor * sqrt((re * re) + (im * im));
 
-        //    i++;
-        // }
+            out[i] = val;
+            out[N - (1 + i)] = val;
+
+            i++;
+        }
+    }
 
-        std::shared_ptr<MlxFixedVector<double>> res = std::make_shared<MlxFixedVector<double>>(integ);
+
+    /* Half Complex Coefficients -> Power per Bin (DC ... Nyquist) */
+    void MlxMixedRadixRealFFT::_powerFromScratch(double *out) const
+    {
+        const size_t N = _length;
+        const double *d = _scratch.data();
+        const double factor = 2.0 / N;
+
+        out[0] = factor * (d[0] * d[0]);
+
+        size_t i = 1;
+
+        for (size_t n = 1; n < N; n += 2)
+        {
+            const double re = d[n];
+            const double im = ((n + 1) < N) ? d[n + 1] : 0.0;
+
+            out[i++] = factor * ((re * re) + (im * im));
+        }
+    }
+
+
+
+    MlxMixedRadixRealFFTFloat::MlxMixedRadixRealFFTFloat(size_t length, FFTBackend_t type)
+    : MlxMixedRadixRealFFTFloat(MlxRealFFTBackendFloat::create(length, type))
+    {
+    }
+
+
+    MlxMixedRadixRealFFTFloat::MlxMixedRadixRealFFTFloat(std::shared_ptr<const MlxRealFFTBackendFloat> backend)
+    : _length(backend->length())
+    , _backend(backend)
+    , _wrk(backend->createWorkspace())
+    , _scratch(backend->length())
+    {
+    }
+
+
+    MlxMixedRadixRealFFTFloat::~MlxMixedRadixRealFFTFloat()
+    {
+    }
+
+
+    size_t MlxMixedRadixRealFFTFloat::length() const
+    {
+        return _length;
+    }
+
+
+    const std::shared_ptr<const MlxRealFFTBackendFloat>& MlxMixedRadixRealFFTFloat::backend() const
+    {
+        return _backend;
+    }
+
+
+    bool MlxMixedRadixRealFFTFloat::transform(float *data)
+    {
+        if (_length == 0) return false;
+
+        return _backend->transform(data, *_wrk);
+    }
+
+
+    std::shared_ptr<MlxFixedVector<float>> MlxMixedRadixRealFFTFloat::normalizedMagnitude(MlxFixedVector<float> &signal)
+    {
+        const size_t N = _length;
+        const size_t M = std::min(_length, signal.size());
+
+        std::shared_ptr<MlxFixedVector<float>> res = std::make_shared<MlxFixedVector<float>>(N);
+        if (N == 0) return res;
+
+        // Shorter Signals are zero-padded to the Plan Length
+        for (size_t k = 0; k < M; k++) _scratch[k] = signal[k];
+        std::fill(_scratch.begin() + M, _scratch.end(), 0.0f);
+
+        if (!_backend->transform(_scratch.data(), *_wrk)) return res;
+
+        const double factor = 2.0 / N;
+
+        double val = factor * (double(_scratch[0]) * _scratch[0]);
+        res->set(0, float(val));
+        res->set(N - 1, float(val));
+
+        size_t i = 1;
+
+        for (size_t n = 1; n < N; n += 2)
+        {
+            // Nyquist Term of even Lengths has no imaginary Part
+            const double re = _scratch[n];
+            const double im = ((n + 1) < N) ? _scratch[n + 1] : 0.0;
+
+            val = factor * sqrt((re * re) + (im * im));
+
+            res->set(i, float(val));
+            res->set(N - (1 + i), float(val));
+
+            i++;
+        }
 
         return res;
     }
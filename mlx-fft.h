@@ -18,7 +18,9 @@
 #pragma once
 
 #include "structures/mlx-vector.h"
+#include "mlx-fft-backend.h"
 #include <math.h>
+#include <functional>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_fft_real.h>
 #include <gsl/gsl_fft_halfcomplex.h>
@@ -26,6 +28,30 @@
 
 namespace mlx {
 
+/**
+ * @brief   Number of Bands of Width df (centered at 0, df, 2 df, ...) covering a one-sided Spectrum
+ * 
+ * @param bins      Spectrum Values (DC ... Nyquist)
+ * @param binWidth  Frequency Spacing of the Bins
+ * @param df        Band Width
+ */
+size_t spectralBandCount(size_t bins, double binWidth, double df);
+
+
+/**
+ * @brief   Sum Spectrum Values into Bands of Width df: Band b collects the Bins in [(b - 0.5) df, (b + 0.5) df)
+ * 
+ * @param values    Spectrum Values
+ * @param bins      Number of Values
+ * @param binWidth  Frequency Spacing of the Bins
+ * @param df        Band Width
+ * @param scale     Factor per Value (binWidth integrates a Density)
+ * @param bands     spectralBandCount() Values
+ */
+void integrateSpectralBands(const double *values, size_t bins, double binWidth, double df, double scale, double *bands);
+
+
+
 /**
  * @brief   Generates a Workspace for GSL Real Input FFT
  * 
@@ -52,31 +78,216 @@ private:
 
 
 
+/**
+ * @brief   Real FFT Plan: shared Backend (see MlxRealFFTBackend) plus own Workspace
+ * 
+ *  The Backend is chosen by Length at Runtime: native for Powers of Two,
+ *  GSL mixed-radix otherwise.
+ */
 class MlxMixedRadixRealFFT
 {
 public:
 
-    MlxMixedRadixRealFFT(size_t length);
+    MlxMixedRadixRealFFT(size_t length, FFTBackend_t type = MLX_FFT_BACKEND_AUTO);
+
+    /**
+     * @brief   Plan on a shared Backend, only the Workspace is allocated
+     * 
+     * @param backend   Backend (determines the Length)
+     */
+    MlxMixedRadixRealFFT(std::shared_ptr<const MlxRealFFTBackend> backend);
+
     ~MlxMixedRadixRealFFT();
 
+    MlxMixedRadixRealFFT(const MlxMixedRadixRealFFT&) = delete;
+    void operator= (const MlxMixedRadixRealFFT&) = delete;
+
 
     size_t length() const;
 
+    const std::shared_ptr<const MlxRealFFTBackend>& backend() const;
+
+    /**
+     * @brief   In-place Transform into Half Complex Coefficients (GSL Layout)
+     * 
+     * @param data  length() Samples
+     * @return      false on Error
+     */
+    bool transform(double *data);
+
+    /**
+     * @brief   In-place inverse Transform of Half Complex Coefficients, scaled by 1 / length()
+     * 
+     * @param data  length() Coefficients, replaced by Samples
+     * @return      false on GSL Error
+     */
+    bool inverse(double *data);
+
+
+    /**
+     * @brief   Frequency-Domain Pipeline in the Caller's Buffer: transform(), Gain per Bin, inverse()
+     * 
+     *  No intermediate Copies. This is circular Convolution within the Block; use
+     *  MlxConvolver (Overlap-Save) for linear Filtering of Streams.
+     * 
+     * @param data  length() Samples, replaced by the filtered Samples
+     * @param gain  psdLength() real Gains (DC ... Nyquist), zero Phase
+     * @return      false on GSL Error
+     */
+    bool spectralFilter(double *data, const double *gain);
+
+    /**
+     * @brief   Pipeline with a complex Transfer Function H[k], k = 0 ... psdLength() - 1
+     * 
+     *  Only the Real Parts of H at DC and Nyquist are used (real Output).
+     * 
+     * @param data      length() Samples, replaced by the filtered Samples
+     * @param transfer  psdLength() Values, any Layout
+     */
+    bool spectralFilter(double *data, const MlxComplexVector &transfer);
+
+    /**
+     * @brief   Pipeline with a Callback working on the Half Complex Buffer (GSL Layout)
+     * 
+     * @param data  length() Samples, replaced by the filtered Samples
+     * @param fn    called with (Coefficients, length())
+     */
+    bool spectralFilter(double *data, const std::function<void(double*, size_t)> &fn);
+
 
     std::shared_ptr<MlxFixedVector<double>> normalizedMagnitude(MlxFixedVector<double> &signal);
 
+    /**
+     * @brief   Power per Bin, for df > 0 summed into Bands of Width df (see integrateSpectralBands)
+     * 
+     * @param signal    Input Signal
+     * @param fs        Sample Frequency
+     * @param df        Band Width in Hz, 0 for the FFT Resolution
+     */
     std::shared_ptr<MlxFixedVector<double>> pwrSpectralDensity(MlxFixedVector<double> &signal, const double fs, const double df);
 
 
+    /**
+     * @brief   Normalized Magnitude into a Caller Buffer, no Heap Allocation
+     * 
+     *  Same Layout and Scaling as the MlxFixedVector Variant. The Transform runs in
+     *  the Plan's Scratch Buffer, so a Plan must not be used by two Threads at once.
+     * 
+     * @param in    length() Samples
+     * @param out   length() Values
+     * @return      false on GSL Error
+     */
+    bool normalizedMagnitude(const double *in, double *out);
+
+    /**
+     * @brief   Power Spectrum into a Caller Buffer, no Heap Allocation
+     * 
+     * @param in    length() Samples
+     * @param out   psdLength() Values
+     * @return      false on GSL Error
+     */
+    bool pwrSpectralDensity(const double *in, double *out);
+
+    /**
+     * @brief   Vector Variants, out is only resized if its Size differs
+     */
+    bool normalizedMagnitude(const std::vector<double> &in, std::vector<double> &out);
+    bool pwrSpectralDensity(const std::vector<double> &in, std::vector<double> &out);
+
+    /**
+     * @brief   unscaled complex one-sided Spectrum (see unpackHalfComplex)
+     * 
+     * @param in    length() Samples
+     * @param out   resized to psdLength() Bins, Layout is kept
+     * @return      false on GSL Error
+     */
+    bool spectrum(const double *in, MlxComplexVector &out);
+
+    /**
+     * @brief   Number of Power Spectrum Values (DC ... Nyquist)
+     */
+    size_t psdLength() const;
+
+
 
 protected:
 
+    bool _transformScratch();
+    void _magnitudeFromScratch(double *out) const;
+    void _powerFromScratch(double *out) const;
+
     const size_t _length;
-    gsl_fft_real_wavetable *_wvt;
-    gsl_fft_real_workspace *_wrk;    
+    std::shared_ptr<const MlxRealFFTBackend> _backend;
+    std::unique_ptr<MlxRealFFTBackend::Workspace> _wrk;
+
+    // Transform Buffer, reused by every Call
+    std::vector<double> _scratch;
 
 
 };  /* MlxMixedRadixRealFFT */
 
 
+
+/**
+ * @brief   Single Precision Real FFT on the float Backends (MlxRealFFTBackendFloat)
+ * 
+ *  Same Backend Selection as MlxMixedRadixRealFFT (native, Bluestein or GSL's
+ *  gsl_fft_real_float_*), but Tables, Workspace and Butterflies are float: half the
+ *  Memory Traffic and twice the SIMD Lanes of the double Plan. Twiddles are rounded
+ *  from double, the relative Error grows with log2(N) FLT_EPSILON. Plans of the same
+ *  Length can share one Backend through the second Constructor.
+ */
+class MlxMixedRadixRealFFTFloat
+{
+public:
+
+    MlxMixedRadixRealFFTFloat(size_t length, FFTBackend_t type = MLX_FFT_BACKEND_AUTO);
+
+    /**
+     * @brief   Plan on a shared Backend, only the Workspace is allocated
+     * 
+     * @param backend   Backend (determines the Length)
+     */
+    MlxMixedRadixRealFFTFloat(std::shared_ptr<const MlxRealFFTBackendFloat> backend);
+
+    ~MlxMixedRadixRealFFTFloat();
+
+    MlxMixedRadixRealFFTFloat(const MlxMixedRadixRealFFTFloat&) = delete;
+    void operator= (const MlxMixedRadixRealFFTFloat&) = delete;
+
+
+    size_t length() const;
+
+    const std::shared_ptr<const MlxRealFFTBackendFloat>& backend() const;
+
+
+    /**
+     * @brief   In-place Transform into Half Complex Coefficients (GSL Layout)
+     * 
+     * @param data  length() Samples
+     * @return      false on Error or for Length 0
+     */
+    bool transform(float *data);
+
+
+    /**
+     * @brief   Same Layout and Scaling as MlxMixedRadixRealFFT::normalizedMagnitude
+     */
+    std::shared_ptr<MlxFixedVector<float>> normalizedMagnitude(MlxFixedVector<float> &signal);
+
+
+
+protected:
+
+    const size_t _length;
+    std::shared_ptr<const MlxRealFFTBackendFloat> _backend;
+    std::unique_ptr<MlxRealFFTBackendFloat::Workspace> _wrk;
+
+    // Transform Buffer for normalizedMagnitude(), reused by every Call
+    std::vector<float> _scratch;
+
+
+};  /* MlxMixedRadixRealFFTFloat */
+
+
 }   /* namespace mlx */
\ No newline at end of file
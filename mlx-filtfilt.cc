@@ -0,0 +1,215 @@
+/**
+ * @file    mlx-filtfilt.cc
+ * @brief   Zero-Phase (Forward-Backward) SOS Filtering
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-filtfilt.h"
+
+#include <algorithm>
+
+
+namespace mlx
+{
+
+    /**
+     * @brief   Default Edge Extension as in scipy sosfiltfilt: 3 * (2 * stages + 1),
+     *          reduced by Stages that are only first Order
+     */
+    static size_t _defaultPadLength(const MlxSOSFilter &filter)
+    {
+        size_t zb = 0;
+        size_t za = 0;
+
+        for (const MlxSOSFilterStage& fil : filter.getStages())
+        {
+            if (fil.b2() == 0.0) zb++;
+            if (fil.a2() == 0.0) za++;
+        }
+
+        return 3 * ((2 * filter.stages()) + 1 - std::min(zb, za));
+    }
+
+
+    MlxZeroPhaseFilter::MlxZeroPhaseFilter(std::shared_ptr<MlxSOSFilter> filter, PaddingType_t padType)
+    : _filter(filter)
+    , _padType(padType)
+    , _padLength(padType == MLX_PADDING_NONE ? 0 : _defaultPadLength(*filter))
+    {
+        _computeSteadyState();
+    }
+
+
+    MlxZeroPhaseFilter::MlxZeroPhaseFilter(std::shared_ptr<MlxSOSFilter> filter, PaddingType_t padType, size_t padLength)
+    : _filter(filter)
+    , _padType(padType)
+    , _padLength(padType == MLX_PADDING_NONE ? 0 : padLength)
+    {
+        _computeSteadyState();
+    }
+
+
+    MlxZeroPhaseFilter::~MlxZeroPhaseFilter()
+    {
+    }
+
+
+    size_t MlxZeroPhaseFilter::padLength() const
+    {
+        return _padLength;
+    }
+
+
+    PaddingType_t MlxZeroPhaseFilter::padType() const
+    {
+        return _padType;
+    }
+
+
+    bool MlxZeroPhaseFilter::apply(const double *in, double *out, size_t n)
+    {
+        if ((n == 0) || (n <= _padLength))
+        {
+            return false;
+        }
+
+        // Extension has to be taken before out overwrites in
+        _extend(in, n);
+
+        const size_t P = _padLength;
+
+        // Forward Pass - left Extension only warms up the State
+        _setInitialConditions(P > 0 ? _padLeft[0] : in[0]);
+
+        _filter->filter(_padLeft.data(), P);
+        _filter->filter(in, out, n);
+        _filter->filter(_padRight.data(), P);
+
+        // Backward Pass - starts at the End of the right Extension
+        _setInitialConditions(P > 0 ? _padRight[P - 1] : out[n - 1]);
+
+        _filterReversed(_padRight.data(), P);
+        _filterReversed(out, n);
+
+        return true;
+    }
+
+
+    bool MlxZeroPhaseFilter::apply(double *data, size_t n)
+    {
+        return apply(data, data, n);
+    }
+
+
+    bool MlxZeroPhaseFilter::apply(const std::shared_ptr<MlxVector> input, std::shared_ptr<MlxVector> output)
+    {
+        if (input->size() > output->size())
+        {
+            return false;
+        }
+
+        return apply(input->getGslVector()->data, output->getGslVector()->data, input->size());
+    }
+
+
+    void MlxZeroPhaseFilter::_computeSteadyState()
+    {
+        /*
+         *  Steady State of one Stage for constant Input x = 1 (Gain G):
+         *      t0 = G - b0,   t1 = b2 - a2 * G
+         *  Every Stage sees the DC Gain of all preceding Stages as Input.
+         */
+        double scale = 1.0;
+
+        _zi.clear();
+
+        for (const MlxSOSFilterStage& fil : _filter->getStages())
+        {
+            const double den = 1.0 + fil.a1() + fil.a2();
+            const double G = (den != 0.0) ? ((fil.b0() + fil.b1() + fil.b2()) / den) : 0.0;
+
+            _zi.push_back(scale * (G - fil.b0()));
+            _zi.push_back(scale * (fil.b2() - (fil.a2() * G)));
+
+            scale *= G;
+        }
+
+        _padLeft.resize(_padLength);
+        _padRight.resize(_padLength);
+        _block.resize(MLX_FILTFILT_BLOCK_SIZE);
+    }
+
+
+    void MlxZeroPhaseFilter::_setInitialConditions(double x0)
+    {
+        for (size_t s = 0; s < _filter->stages(); s++)
+        {
+            _filter->setStageState(s, x0 * _zi[2 * s], x0 * _zi[(2 * s) + 1]);
+        }
+    }
+
+
+    void MlxZeroPhaseFilter::_extend(const double *in, size_t n)
+    {
+        const size_t P = _padLength;
+        const double first = in[0];
+        const double last = in[n - 1];
+
+        for (size_t i = 0; i < P; i++)
+        {
+            // Mirrored around first / last Sample, Edge Samples themselves are not repeated
+            const double l = in[P - i];
+            const double r = in[n - 2 - i];
+
+            switch (_padType)
+            {
+            case MLX_PADDING_ODD:
+                _padLeft[i] = (2.0 * first) - l;
+                _padRight[i] = (2.0 * last) - r;
+                break;
+
+            case MLX_PADDING_EVEN:
+                _padLeft[i] = l;
+                _padRight[i] = r;
+                break;
+
+            case MLX_PADDING_CONSTANT:
+                _padLeft[i] = first;
+                _padRight[i] = last;
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+
+
+    void MlxZeroPhaseFilter::_filterReversed(double *data, size_t n)
+    {
+        size_t end = n;
+
+        while (end > 0)
+        {
+            const size_t len = std::min(MLX_FILTFILT_BLOCK_SIZE, end);
+            double *blk = data + (end - len);
+
+            std::reverse_copy(blk, blk + len, _block.begin());
+            _filter->filter(_block.data(), len);
+            std::reverse_copy(_block.begin(), _block.begin() + len, blk);
+
+            end -= len;
+        }
+    }
+
+
+}   /* namespace mlx */
@@ -0,0 +1,125 @@
+/**
+ * @file    mlx-filtfilt.h
+ * @brief   Zero-Phase (Forward-Backward) SOS Filtering
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "structures/mlx-vector.h"
+#include "mlx-sos-filter.h"
+
+
+namespace mlx
+{
+
+    /* Number of Samples reversed at once during the backward Pass */
+    static const size_t MLX_FILTFILT_BLOCK_SIZE = 1024;
+
+
+    typedef enum {
+        MLX_PADDING_NONE = 0,
+        MLX_PADDING_ODD = 1,
+        MLX_PADDING_EVEN = 2,
+        MLX_PADDING_CONSTANT = 3,
+    } PaddingType_t;
+
+
+    /**
+     * @brief   Zero-Phase Filter Engine (equivalent to scipy sosfiltfilt)
+     *
+     *  The Signal is extended at both Edges, the Filter starts every Pass from
+     *  Steady-State Initial Conditions (sosfilt_zi) scaled to the first Sample.
+     *  Padding and the reversed Pass run through Buffers owned by the Engine,
+     *  so repeated Calls do not allocate.
+     */
+    class MlxZeroPhaseFilter
+    {
+    public:
+
+        /**
+         * @brief   Create Zero-Phase Filter
+         *
+         * @param filter        SOS Cascade (its State is overwritten by every Call)
+         * @param padType       Edge Extension
+         */
+        MlxZeroPhaseFilter(std::shared_ptr<MlxSOSFilter> filter, PaddingType_t padType = MLX_PADDING_ODD);
+
+        /**
+         * @brief   Create Zero-Phase Filter
+         *
+         * @param filter        SOS Cascade (its State is overwritten by every Call)
+         * @param padType       Edge Extension
+         * @param padLength     Number of Samples to extend at each Edge
+         */
+        MlxZeroPhaseFilter(std::shared_ptr<MlxSOSFilter> filter, PaddingType_t padType, size_t padLength);
+
+        ~MlxZeroPhaseFilter();
+
+
+        size_t padLength() const;
+        PaddingType_t padType() const;
+
+
+        /**
+         * @brief   Filter forward and backward
+         *
+         * @param in    Input Samples
+         * @param out   Output Samples (may be equal to in)
+         * @param n     Number of Samples, must be greater than padLength()
+         * @return      false if the Signal is too short
+         */
+        bool apply(const double *in, double *out, size_t n);
+
+        /**
+         * @brief   Filter forward and backward in-place
+         *
+         * @param data  Samples
+         * @param n     Number of Samples, must be greater than padLength()
+         * @return      false if the Signal is too short
+         */
+        bool apply(double *data, size_t n);
+
+        bool apply(const std::shared_ptr<MlxVector> input, std::shared_ptr<MlxVector> output);
+
+
+    protected:
+
+        void _computeSteadyState();
+        void _setInitialConditions(double x0);
+        void _extend(const double *in, size_t n);
+        void _filterReversed(double *data, size_t n);
+
+        std::shared_ptr<MlxSOSFilter> _filter;
+
+        const PaddingType_t _padType;
+        const size_t _padLength;
+
+        // Steady-State Mem-Elements for unit Input - 2 per Stage
+        std::vector<double> _zi;
+
+        // Left and right Edge Extension
+        std::vector<double> _padLeft;
+        std::vector<double> _padRight;
+
+        // Scratch for the reversed Pass
+        std::vector<double> _block;
+
+
+    };  /* MlxZeroPhaseFilter */
+
+
+}   /* namespace mlx */
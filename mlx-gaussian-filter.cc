@@ -18,6 +18,9 @@
 #include <gsl/gsl_filter.h>
 #include <gsl/gsl_vector.h>
 
+#include <algorithm>
+#include <math.h>
+
 
 namespace mlx
 {
@@ -52,19 +55,18 @@ namespace mlx
         if (K < 1)
         {
             _kernelSize = DEFAULT_FILTER_KERNEL_SIZE;
-            return;
         }
-            
-        
-        // Kernel Size should always be odd
-        if ((K % 2) == 0)
+        else if ((K % 2) == 0)
         {
+            // Kernel Size should always be odd
             _kernelSize = K + 1;
         }
         else
         {
             _kernelSize = K;
         }
+
+        _updateKernelF();
     }
 
 
@@ -93,6 +95,7 @@ namespace mlx
         if (a <= 0) return;
 
         _alpha = a;
+        _updateKernelF();
     }
 
     double MlxGaussianFilter::getAlpha() const 
@@ -122,6 +125,69 @@ namespace mlx
     }
 
 
+    bool MlxGaussianFilter::apply(const float *input, float *output, size_t n)
+    {
+        if (n == 0) return false;
+
+        const size_t K = _kernelSize;
+        const size_t H = K / 2;
+
+        // Pad with the first / last Value (GSL_FILTER_END_PADVALUE), the Buffer only grows
+        if (_padF.size() < (n + K - 1)) _padF.resize(n + K - 1);
+
+        std::fill(_padF.begin(), _padF.begin() + H, input[0]);
+        std::copy(input, input + n, _padF.begin() + H);
+        std::fill(_padF.begin() + H + n, _padF.begin() + n + K - 1, input[n - 1]);
+
+        // Kernel-outer over Blocks of Outputs, the inner Loop vectorizes
+        static const size_t BLOCK = 512;
+        float acc[BLOCK];
+
+        for (size_t i0 = 0; i0 < n; i0 += BLOCK)
+        {
+            const size_t len = std::min(BLOCK, n - i0);
+            const float *src = _padF.data() + i0;
+
+            std::fill(acc, acc + len, 0.0f);
+
+            for (size_t j = 0; j < K; j++)
+            {
+                const float kj = _kernelF[j];
+                for (size_t i = 0; i < len; i++) acc[i] += kj * src[i + j];
+            }
+
+            std::copy(acc, acc + len, output + i0);
+        }
+
+        return true;
+    }
+
+
+    void MlxGaussianFilter::_updateKernelF()
+    {
+        const size_t K = _kernelSize;
+
+        // Kernel as gsl_filter_gaussian_kernel(alpha, 0, 1, ...), normalized in double
+        std::vector<double> kernel(K, 1.0);
+        const double half = 0.5 * (K - 1.0);
+        double sum = 0.0;
+
+        for (size_t i = 0; i < K; i++)
+        {
+            if (half > 0.0)
+            {
+                const double xi = (i - half) / half;
+                kernel[i] = exp(-0.5 * _alpha * _alpha * xi * xi);
+            }
+
+            sum += kernel[i];
+        }
+
+        _kernelF.resize(K);
+        for (size_t i = 0; i < K; i++) _kernelF[i] = float(kernel[i] / sum);
+    }
+
+
     void MlxGaussianFilter::_initializeWorkspace()
     {
         _freeWorkspace();
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "structures/mlx-vector.h"
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_vector.h>
@@ -57,12 +58,28 @@ namespace mlx
 
         bool apply(const std::shared_ptr<MlxVector> input, std::shared_ptr<MlxVector> output);
 
+        /**
+         * @brief   Filter float Samples, same Kernel and Edge Handling (Pad Value) as the GSL Path
+         * 
+         *  Kernel is computed and normalized in double, the Convolution accumulates in float
+         *  (Kernel is positive with Sum 1, so the Error stays in the Order of K * FLT_EPSILON).
+         * 
+         * @param input     Input Samples
+         * @param output    Output Samples (must not overlap input)
+         * @param n         Number of Samples
+         * @return          false for empty Input
+         */
+        bool apply(const float *input, float *output, size_t n);
+
 
     protected:
 
         void _initializeWorkspace();
         void _freeWorkspace();
 
+        /* Kernel of the float Path, rebuilt whenever Kernel Size or Alpha change */
+        void _updateKernelF();
+
     private:
 
         size_t _kernelSize;
@@ -72,6 +89,10 @@ namespace mlx
         gsl_filter_gaussian_workspace *_ws;
         gsl_vector *_kernel;
 
+        // float Path: normalized Kernel and padded Input (grows to the longest Input)
+        std::vector<float> _kernelF;
+        std::vector<float> _padF;
+
 
     };  /* MlxGaussianFiler */
 
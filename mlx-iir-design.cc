@@ -0,0 +1,784 @@
+/**
+ * @file    mlx-iir-design.cc
+ * @brief   Digital IIR Filter Design (Analog Prototype -> Bilinear Transform -> SOS)
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-iir-design.h"
+
+#include <complex>
+#include <limits>
+#include <algorithm>
+#include <math.h>
+
+
+namespace mlx
+{
+
+    typedef std::complex<double> cplx;
+    typedef std::vector<cplx> cvec;
+
+
+    static const double MLX_IIR_EPS = std::numeric_limits<double>::epsilon();
+
+
+    /**
+     * @brief   Zeros, Poles and Gain of a Transfer Function
+     */
+    struct MlxZPK
+    {
+        cvec z;
+        cvec p;
+        double k;
+    };
+
+
+/// Start - Elliptic Functions
+
+
+    static double _agm(double a, double b)
+    {
+        for (size_t n = 0; (n < 64) && (fabs(a - b) > (MLX_IIR_EPS * a)); n++)
+        {
+            const double t = 0.5 * (a + b);
+            b = sqrt(a * b);
+            a = t;
+        }
+
+        return a;
+    }
+
+
+    /* Complete elliptic Integral of the first Kind K(m) */
+    static double _ellipk(double m)
+    {
+        return M_PI / (2.0 * _agm(1.0, sqrt(1.0 - m)));
+    }
+
+
+    /* K(1 - p), accurate for small p */
+    static double _ellipkm1(double p)
+    {
+        return M_PI / (2.0 * _agm(1.0, sqrt(p)));
+    }
+
+
+    /* Jacobian elliptic Functions sn, cn, dn (Descending Landen / AGM, as Cephes ellpj) */
+    static void _ellipj(double u, double m, double &sn, double &cn, double &dn)
+    {
+        if (m < 1.0e-9)
+        {
+            const double t = sin(u);
+            const double b = cos(u);
+            const double ai = 0.25 * m * (u - (t * b));
+
+            sn = t - (ai * b);
+            cn = b + (ai * t);
+            dn = 1.0 - (0.5 * m * t * t);
+            return;
+        }
+
+        if (m >= 0.9999999999)
+        {
+            double ai = 0.25 * (1.0 - m);
+            const double b = cosh(u);
+            const double t = tanh(u);
+            const double phi = 1.0 / b;
+            const double twon = b * sinh(u);
+
+            sn = t + (ai * (twon - u) / (b * b));
+            ai *= t * phi;
+            cn = phi - (ai * (twon - u));
+            dn = phi + (ai * (twon + u));
+            return;
+        }
+
+        double a[9];
+        double c[9];
+        double b = sqrt(1.0 - m);
+        double twon = 1.0;
+        size_t i = 0;
+
+        a[0] = 1.0;
+        c[0] = sqrt(m);
+
+        while (fabs(c[i] / a[i]) > MLX_IIR_EPS)
+        {
+            if (i > 7) break;
+
+            const double ai = a[i];
+            ++i;
+            c[i] = 0.5 * (ai - b);
+            const double t = sqrt(ai * b);
+            a[i] = 0.5 * (ai + b);
+            b = t;
+            twon *= 2.0;
+        }
+
+        double phi = twon * a[i] * u;
+        double prev = phi;
+
+        do
+        {
+            const double t = c[i] * sin(phi) / a[i];
+            prev = phi;
+            phi = 0.5 * (asin(t) + phi);
+        }
+        while (--i);
+
+        sn = sin(phi);
+        cn = cos(phi);
+        dn = cn / cos(phi - prev);
+    }
+
+
+    /* Elliptic Modulus for Degree n and Modulus m1 (Nome Series) */
+    static double _ellipdeg(size_t n, double m1)
+    {
+        const double K1 = _ellipk(m1);
+        const double K1p = _ellipkm1(m1);
+        const double q1 = exp(-M_PI * K1p / K1);
+        const double q = pow(q1, 1.0 / n);
+
+        double num = 0.0;
+        double den = 0.0;
+
+        for (int k = 0; k <= 7; k++) num += pow(q, k * (k + 1));
+        for (int k = 1; k <= 8; k++) den += pow(q, k * k);
+
+        den = 1.0 + (2.0 * den);
+
+        return 16.0 * q * pow(num / den, 4);
+    }
+
+
+    /* Carlson symmetric Integral R_F(x, y, z) (Duplication Theorem) */
+    static double _carlsonRF(double x, double y, double z)
+    {
+        double mu = 0.0;
+        double dx = 0.0, dy = 0.0, dz = 0.0;
+
+        for (size_t n = 0; n < 64; n++)
+        {
+            const double sx = sqrt(x);
+            const double sy = sqrt(y);
+            const double sz = sqrt(z);
+            const double lambda = (sx * (sy + sz)) + (sy * sz);
+
+            x = 0.25 * (x + lambda);
+            y = 0.25 * (y + lambda);
+            z = 0.25 * (z + lambda);
+
+            mu = (x + y + z) / 3.0;
+            dx = (mu - x) / mu;
+            dy = (mu - y) / mu;
+            dz = (mu - z) / mu;
+
+            if (std::max(fabs(dx), std::max(fabs(dy), fabs(dz))) < 1.0e-4) break;
+        }
+
+        const double e2 = (dx * dy) - (dz * dz);
+        const double e3 = dx * dy * dz;
+
+        return (1.0 + (((e2 / 24.0) - 0.1 - (3.0 * e3 / 44.0)) * e2) + (e3 / 14.0)) / sqrt(mu);
+    }
+
+
+    /* Real Inverse of Jacobian sc with complementary Modulus: sc(u | 1 - m) = w */
+    static double _arcJacSc1(double w, double m)
+    {
+        // u = F(atan(w) | 1 - m)
+        const double phi = atan(w);
+        const double s = sin(phi);
+        const double c = cos(phi);
+
+        return s * _carlsonRF(c * c, 1.0 - ((1.0 - m) * s * s), 1.0);
+    }
+
+
+/// END - Elliptic Functions
+/// Start - Analog Prototypes
+
+
+    static void _buttap(size_t N, MlxZPK &zpk)
+    {
+        for (int m = 1 - (int) N; m < (int) N; m += 2)
+        {
+            zpk.p.push_back(-std::exp(cplx(0.0, M_PI * m / (2.0 * N))));
+        }
+
+        zpk.k = 1.0;
+    }
+
+
+    static void _cheb1ap(size_t N, double rp, MlxZPK &zpk)
+    {
+        const double eps = sqrt(pow(10.0, 0.1 * rp) - 1.0);
+        const double mu = asinh(1.0 / eps) / N;
+
+        cplx prod = 1.0;
+
+        for (int m = 1 - (int) N; m < (int) N; m += 2)
+        {
+            const double theta = M_PI * m / (2.0 * N);
+            const cplx p = -std::sinh(cplx(mu, theta));
+
+            zpk.p.push_back(p);
+            prod *= -p;
+        }
+
+        zpk.k = std::real(prod);
+
+        if ((N % 2) == 0)
+        {
+            zpk.k /= sqrt(1.0 + (eps * eps));
+        }
+    }
+
+
+    static void _cheb2ap(size_t N, double rs, MlxZPK &zpk)
+    {
+        const double de = 1.0 / sqrt(pow(10.0, 0.1 * rs) - 1.0);
+        const double mu = asinh(1.0 / de) / N;
+
+        cplx pz = 1.0;
+        cplx pp = 1.0;
+
+        // Zeros on the imaginary Axis, no Zero at Infinity for odd Order
+        for (int m = 1 - (int) N; m < (int) N; m += 2)
+        {
+            if (m == 0) continue;
+
+            const cplx z = -std::conj(cplx(0.0, 1.0) / sin(m * M_PI / (2.0 * N)));
+            zpk.z.push_back(z);
+            pz *= -z;
+        }
+
+        for (int m = 1 - (int) N; m < (int) N; m += 2)
+        {
+            const cplx b = -std::exp(cplx(0.0, M_PI * m / (2.0 * N)));
+            const cplx p = 1.0 / cplx(sinh(mu) * std::real(b), cosh(mu) * std::imag(b));
+
+            zpk.p.push_back(p);
+            pp *= -p;
+        }
+
+        zpk.k = std::real(pp / pz);
+    }
+
+
+    static void _ellipap(size_t N, double rp, double rs, MlxZPK &zpk)
+    {
+        const double eps_sq = pow(10.0, 0.1 * rp) - 1.0;
+
+        if (N == 1)
+        {
+            const double p = -sqrt(1.0 / eps_sq);
+            zpk.p.push_back(p);
+            zpk.k = -p;
+            return;
+        }
+
+        const double eps = sqrt(eps_sq);
+        const double ck1_sq = eps_sq / (pow(10.0, 0.1 * rs) - 1.0);
+
+        const double val0 = _ellipk(ck1_sq);
+        const double m = _ellipdeg(N, ck1_sq);
+        const double capk = _ellipk(m);
+
+        const double r = _arcJacSc1(1.0 / eps, ck1_sq);
+        const double v0 = capk * r / (N * val0);
+
+        double sv, cv, dv;
+        _ellipj(v0, 1.0 - m, sv, cv, dv);
+
+        cvec zh;
+        cvec ph;
+
+        for (size_t j = 1 - (N % 2); j < N; j += 2)
+        {
+            double s, c, d;
+            _ellipj(j * capk / N, m, s, c, d);
+
+            if (fabs(s) > MLX_IIR_EPS)
+            {
+                zh.push_back(cplx(0.0, 1.0 / (sqrt(m) * s)));
+            }
+
+            ph.push_back(-cplx(c * d * sv * cv, s * dv) / (1.0 - ((d * sv) * (d * sv))));
+        }
+
+        for (const cplx& z : zh) zpk.z.push_back(z);
+        for (const cplx& z : zh) zpk.z.push_back(std::conj(z));
+
+        double norm = 0.0;
+        for (const cplx& p : ph) norm += std::norm(p);
+        norm = sqrt(norm);
+
+        for (const cplx& p : ph) zpk.p.push_back(p);
+        for (const cplx& p : ph)
+        {
+            // For odd Order the real Pole is not duplicated
+            if (((N % 2) == 0) || (fabs(std::imag(p)) > (MLX_IIR_EPS * norm)))
+            {
+                zpk.p.push_back(std::conj(p));
+            }
+        }
+
+        cplx pp = 1.0;
+        cplx pz = 1.0;
+
+        for (const cplx& p : zpk.p) pp *= -p;
+        for (const cplx& z : zpk.z) pz *= -z;
+
+        zpk.k = std::real(pp / pz);
+
+        if ((N % 2) == 0)
+        {
+            zpk.k /= sqrt(1.0 + eps_sq);
+        }
+    }
+
+
+    static void _besselap(size_t N, MlxZPK &zpk)
+    {
+        /*
+         *  Poles are the Roots of the reverse Bessel Polynomial
+         *      theta_N(s) = sum a_k s^k,  a_k = (2N-k)! / (2^(N-k) k! (N-k)!)
+         *  Phase Normalization scales s by a_0^(1/N), after which the Polynomial
+         *  is monic with unit constant Term and its Roots lie near the Butterworth Poles.
+         */
+        const double la0 = lgamma(2.0 * N + 1.0) - (N * M_LN2) - lgamma(N + 1.0);
+
+        std::vector<double> c(N + 1);
+
+        for (size_t k = 0; k <= N; k++)
+        {
+            const double lak = lgamma(2.0 * N - k + 1.0) - ((N - k) * M_LN2) - lgamma(k + 1.0) - lgamma(N - k + 1.0);
+            c[k] = exp(lak + (la0 * ((double) k / N - 1.0)));
+        }
+
+        // Durand-Kerner, started from the Butterworth Poles
+        cvec r;
+        for (int m = 1 - (int) N; m < (int) N; m += 2)
+        {
+            r.push_back(-std::exp(cplx(0.0, M_PI * m / (2.0 * N))) * cplx(1.0, 0.01 * m));
+        }
+
+        for (size_t it = 0; it < 500; it++)
+        {
+            double delta = 0.0;
+
+            for (size_t i = 0; i < N; i++)
+            {
+                cplx num = c[N];
+                for (size_t k = N; k-- > 0;) num = (num * r[i]) + c[k];
+
+                cplx den = c[N];
+                for (size_t j = 0; j < N; j++)
+                {
+                    if (j != i) den *= (r[i] - r[j]);
+                }
+
+                const cplx step = num / den;
+                r[i] -= step;
+                delta = std::max(delta, std::abs(step));
+            }
+
+            if (delta < (1.0e-15)) break;
+        }
+
+        for (cplx& p : r)
+        {
+            if (fabs(std::imag(p)) < (1.0e-10 * std::abs(p))) p = std::real(p);
+            zpk.p.push_back(p);
+        }
+
+        zpk.k = 1.0;
+    }
+
+
+/// END - Analog Prototypes
+/// Start - Transformations
+
+
+    static double _degree(const MlxZPK &zpk)
+    {
+        return (double) zpk.p.size() - (double) zpk.z.size();
+    }
+
+
+    static cplx _prodNeg(const cvec &v)
+    {
+        cplx prod = 1.0;
+        for (const cplx& x : v) prod *= -x;
+        return prod;
+    }
+
+
+    static void _lp2lp(MlxZPK &zpk, double wo)
+    {
+        const double deg = _degree(zpk);
+
+        for (cplx& z : zpk.z) z *= wo;
+        for (cplx& p : zpk.p) p *= wo;
+
+        zpk.k *= pow(wo, deg);
+    }
+
+
+    static void _lp2hp(MlxZPK &zpk, double wo)
+    {
+        const size_t deg = zpk.p.size() - zpk.z.size();
+
+        zpk.k *= std::real(_prodNeg(zpk.z) / _prodNeg(zpk.p));
+
+        for (cplx& z : zpk.z) z = wo / z;
+        for (cplx& p : zpk.p) p = wo / p;
+
+        zpk.z.insert(zpk.z.end(), deg, cplx(0.0));
+    }
+
+
+    static cvec _splitBand(const cvec &v, double wo)
+    {
+        cvec out;
+
+        for (const cplx& x : v) out.push_back(x + std::sqrt((x * x) - (wo * wo)));
+        for (const cplx& x : v) out.push_back(x - std::sqrt((x * x) - (wo * wo)));
+
+        return out;
+    }
+
+
+    static void _lp2bp(MlxZPK &zpk, double wo, double bw)
+    {
+        const size_t deg = zpk.p.size() - zpk.z.size();
+
+        for (cplx& z : zpk.z) z *= 0.5 * bw;
+        for (cplx& p : zpk.p) p *= 0.5 * bw;
+
+        zpk.z = _splitBand(zpk.z, wo);
+        zpk.p = _splitBand(zpk.p, wo);
+
+        zpk.z.insert(zpk.z.end(), deg, cplx(0.0));
+        zpk.k *= pow(bw, (double) deg);
+    }
+
+
+    static void _lp2bs(MlxZPK &zpk, double wo, double bw)
+    {
+        const size_t deg = zpk.p.size() - zpk.z.size();
+
+        zpk.k *= std::real(_prodNeg(zpk.z) / _prodNeg(zpk.p));
+
+        for (cplx& z : zpk.z) z = (0.5 * bw) / z;
+        for (cplx& p : zpk.p) p = (0.5 * bw) / p;
+
+        zpk.z = _splitBand(zpk.z, wo);
+        zpk.p = _splitBand(zpk.p, wo);
+
+        zpk.z.insert(zpk.z.end(), deg, cplx(0.0, wo));
+        zpk.z.insert(zpk.z.end(), deg, cplx(0.0, -wo));
+    }
+
+
+    static void _bilinear(MlxZPK &zpk, double fs)
+    {
+        const double fs2 = 2.0 * fs;
+        const size_t deg = zpk.p.size() - zpk.z.size();
+
+        cplx num = 1.0;
+        cplx den = 1.0;
+
+        for (cplx& z : zpk.z)
+        {
+            num *= (fs2 - z);
+            z = (fs2 + z) / (fs2 - z);
+        }
+
+        for (cplx& p : zpk.p)
+        {
+            den *= (fs2 - p);
+            p = (fs2 + p) / (fs2 - p);
+        }
+
+        zpk.z.insert(zpk.z.end(), deg, cplx(-1.0));
+        zpk.k *= std::real(num / den);
+    }
+
+
+/// END - Transformations
+/// Start - SOS Conversion
+
+
+    static bool _isReal(const cplx &x)
+    {
+        return std::imag(x) == 0.0;
+    }
+
+
+    /* One Representative per conjugate Pair (positive Imag), followed by the real Values */
+    static cvec _cplxreal(const cvec &v)
+    {
+        cvec zc;
+        cvec zr;
+
+        for (const cplx& x : v)
+        {
+            if (fabs(std::imag(x)) <= (100.0 * MLX_IIR_EPS * std::abs(x)))
+            {
+                zr.push_back(std::real(x));
+            }
+            else if (std::imag(x) > 0.0)
+            {
+                zc.push_back(x);
+            }
+        }
+
+        auto byReal = [](const cplx &a, const cplx &b) { return std::real(a) < std::real(b); };
+        std::stable_sort(zc.begin(), zc.end(), byReal);
+        std::stable_sort(zr.begin(), zr.end(), byReal);
+
+        zc.insert(zc.end(), zr.begin(), zr.end());
+        return zc;
+    }
+
+
+    typedef enum { _NEAREST_ANY, _NEAREST_REAL, _NEAREST_COMPLEX } _nearest_t;
+
+
+    static size_t _nearestIdx(const cvec &from, const cplx &to, _nearest_t which)
+    {
+        size_t best = from.size();
+        double dist = 0.0;
+
+        for (size_t n = 0; n < from.size(); n++)
+        {
+            if ((which == _NEAREST_REAL) && !_isReal(from[n])) continue;
+            if ((which == _NEAREST_COMPLEX) && _isReal(from[n])) continue;
+
+            const double d = std::abs(from[n] - to);
+
+            if ((best == from.size()) || (d < dist))
+            {
+                best = n;
+                dist = d;
+            }
+        }
+
+        return best;
+    }
+
+
+    static cplx _take(cvec &v, size_t idx)
+    {
+        const cplx x = v[idx];
+        v.erase(v.begin() + idx);
+        return x;
+    }
+
+
+    static MlxSOSCoefficients _section(const cvec &z, const cvec &p)
+    {
+        // Polynomials are right aligned, missing leading Coefficients are zero
+        double b[3] = { 0.0, 0.0, 1.0 };
+        double a[3] = { 0.0, 0.0, 1.0 };
+
+        if (z.size() == 1) { b[1] = 1.0; b[2] = -std::real(z[0]); }
+        if (z.size() == 2) { b[0] = 1.0; b[1] = -std::real(z[0] + z[1]); b[2] = std::real(z[0] * z[1]); }
+
+        if (p.size() == 1) { a[1] = 1.0; a[2] = -std::real(p[0]); }
+        if (p.size() == 2) { a[0] = 1.0; a[1] = -std::real(p[0] + p[1]); a[2] = std::real(p[0] * p[1]); }
+
+        return MlxSOSCoefficients { b[0], b[1], b[2], a[1], a[2] };
+    }
+
+
+    static void _zpk2sos(MlxZPK zpk, std::vector<MlxSOSCoefficients> &sos)
+    {
+        sos.clear();
+
+        if (zpk.z.empty() && zpk.p.empty())
+        {
+            sos.push_back(MlxSOSCoefficients { zpk.k, 0.0, 0.0, 0.0, 0.0 });
+            return;
+        }
+
+        if (zpk.p.size() < zpk.z.size()) zpk.p.insert(zpk.p.end(), zpk.z.size() - zpk.p.size(), cplx(0.0));
+        if (zpk.z.size() < zpk.p.size()) zpk.z.insert(zpk.z.end(), zpk.p.size() - zpk.z.size(), cplx(0.0));
+
+        const size_t nsec = (zpk.p.size() + 1) / 2;
+
+        if ((zpk.p.size() % 2) == 1)
+        {
+            zpk.p.push_back(0.0);
+            zpk.z.push_back(0.0);
+        }
+
+        cvec z = _cplxreal(zpk.z);
+        cvec p = _cplxreal(zpk.p);
+
+        sos.resize(nsec);
+
+        // Sections are built from the Back, Poles closest to the unit Circle last
+        for (size_t si = nsec; si-- > 0;)
+        {
+            size_t idx = 0;
+            for (size_t n = 1; n < p.size(); n++)
+            {
+                if (fabs(1.0 - std::abs(p[n])) < fabs(1.0 - std::abs(p[idx]))) idx = n;
+            }
+
+            const cplx p1 = _take(p, idx);
+
+            const size_t realP = std::count_if(p.begin(), p.end(), _isReal);
+            const size_t realZ = std::count_if(z.begin(), z.end(), _isReal);
+
+            if (_isReal(p1) && (realP == 0))
+            {
+                // Last remaining real Pole
+                const cplx z1 = _take(z, _nearestIdx(z, p1, _NEAREST_REAL));
+                sos[si] = _section({ z1, 0.0 }, { p1, 0.0 });
+            }
+            else if (((p.size() + 1) == z.size()) && !_isReal(p1) && (realP == 1) && (realZ == 1))
+            {
+                // One real Pole and Zero left - pair with a complex Zero
+                const cplx z1 = _take(z, _nearestIdx(z, p1, _NEAREST_COMPLEX));
+                sos[si] = _section({ z1, std::conj(z1) }, { p1, std::conj(p1) });
+            }
+            else
+            {
+                cplx p2 = std::conj(p1);
+
+                if (_isReal(p1))
+                {
+                    size_t best = p.size();
+                    for (size_t n = 0; n < p.size(); n++)
+                    {
+                        if (!_isReal(p[n])) continue;
+                        if ((best == p.size()) || (fabs(std::abs(p[n]) - 1.0) < fabs(std::abs(p[best]) - 1.0))) best = n;
+                    }
+
+                    p2 = _take(p, best);
+                }
+
+                if (!z.empty())
+                {
+                    const cplx z1 = _take(z, _nearestIdx(z, p1, _NEAREST_ANY));
+
+                    if (!_isReal(z1))
+                    {
+                        sos[si] = _section({ z1, std::conj(z1) }, { p1, p2 });
+                    }
+                    else if (!z.empty())
+                    {
+                        const cplx z2 = _take(z, _nearestIdx(z, p1, _NEAREST_REAL));
+                        sos[si] = _section({ z1, z2 }, { p1, p2 });
+                    }
+                    else
+                    {
+                        sos[si] = _section({ z1 }, { p1, p2 });
+                    }
+                }
+                else
+                {
+                    sos[si] = _section({}, { p1, p2 });
+                }
+            }
+        }
+
+        sos[0].b0 *= zpk.k;
+        sos[0].b1 *= zpk.k;
+        sos[0].b2 *= zpk.k;
+    }
+
+
+/// END - SOS Conversion
+
+
+    bool designIIR(const MlxIIRDesignSpec &spec, std::vector<MlxSOSCoefficients> &sos)
+    {
+        const bool isBand = (spec.band == MLX_IIR_BANDPASS) || (spec.band == MLX_IIR_BANDSTOP);
+        const double nyq = 0.5 * spec.fs;
+
+        if ((spec.order < 1) || (spec.fs <= 0.0)) return false;
+        if ((spec.fc1 <= 0.0) || (spec.fc1 >= nyq)) return false;
+        if (isBand && ((spec.fc2 <= spec.fc1) || (spec.fc2 >= nyq))) return false;
+
+        MlxZPK zpk;
+        zpk.k = 1.0;
+
+        switch (spec.family)
+        {
+        case MLX_IIR_BUTTERWORTH:
+            _buttap(spec.order, zpk);
+            break;
+
+        case MLX_IIR_BESSEL:
+            _besselap(spec.order, zpk);
+            break;
+
+        case MLX_IIR_CHEBYSHEV1:
+            if (spec.rp <= 0.0) return false;
+            _cheb1ap(spec.order, spec.rp, zpk);
+            break;
+
+        case MLX_IIR_CHEBYSHEV2:
+            if (spec.rs <= 0.0) return false;
+            _cheb2ap(spec.order, spec.rs, zpk);
+            break;
+
+        case MLX_IIR_ELLIPTIC:
+            if ((spec.rp <= 0.0) || (spec.rs <= spec.rp)) return false;
+            _ellipap(spec.order, spec.rp, spec.rs, zpk);
+            break;
+
+        default:
+            return false;
+        }
+
+        // Prewarp normalized Edges (Nyquist = 1) for the Bilinear Transform with fs = 2
+        const double fsn = 2.0;
+        const double w1 = 2.0 * fsn * tan(M_PI * (spec.fc1 / nyq) / fsn);
+        const double w2 = isBand ? 2.0 * fsn * tan(M_PI * (spec.fc2 / nyq) / fsn) : 0.0;
+
+        switch (spec.band)
+        {
+        case MLX_IIR_LOWPASS:
+            _lp2lp(zpk, w1);
+            break;
+
+        case MLX_IIR_HIGHPASS:
+            _lp2hp(zpk, w1);
+            break;
+
+        case MLX_IIR_BANDPASS:
+            _lp2bp(zpk, sqrt(w1 * w2), w2 - w1);
+            break;
+
+        case MLX_IIR_BANDSTOP:
+            _lp2bs(zpk, sqrt(w1 * w2), w2 - w1);
+            break;
+
+        default:
+            return false;
+        }
+
+        _bilinear(zpk, fsn);
+        _zpk2sos(zpk, sos);
+
+        return true;
+    }
+
+
+}   /* namespace mlx */
@@ -0,0 +1,98 @@
+/**
+ * @file    mlx-iir-design.h
+ * @brief   Digital IIR Filter Design (Analog Prototype -> Bilinear Transform -> SOS)
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <tuple>
+#include <cstddef>
+
+
+namespace mlx
+{
+
+    typedef enum {
+        MLX_IIR_BUTTERWORTH = 1,
+        MLX_IIR_BESSEL = 2,
+        MLX_IIR_CHEBYSHEV1 = 3,
+        MLX_IIR_CHEBYSHEV2 = 4,
+        MLX_IIR_ELLIPTIC = 5,
+    } IIRFamily_t;
+
+
+    typedef enum {
+        MLX_IIR_LOWPASS = 1,
+        MLX_IIR_HIGHPASS = 2,
+        MLX_IIR_BANDPASS = 3,
+        MLX_IIR_BANDSTOP = 4,
+    } IIRBand_t;
+
+
+    /**
+     * @brief   Parameters of a digital IIR Design, also used as Cache Key
+     *
+     *  Frequencies are given in Hz. fc2 is only used for Band-Pass and Band-Stop.
+     *  rp (Passband Ripple, dB) is used by Chebyshev I and Elliptic,
+     *  rs (Stopband Attenuation, dB) by Chebyshev II and Elliptic.
+     *  Bessel Filters are phase-normalized (Asymptotes as Butterworth).
+     */
+    struct MlxIIRDesignSpec
+    {
+        IIRFamily_t family;
+        IIRBand_t band;
+        size_t order;
+        double fs;
+        double fc1;
+        double fc2;
+        double rp;
+        double rs;
+
+        bool operator< (const MlxIIRDesignSpec &other) const
+        {
+            return std::tie(family, band, order, fs, fc1, fc2, rp, rs)
+                < std::tie(other.family, other.band, other.order, other.fs, other.fc1, other.fc2, other.rp, other.rs);
+        }
+    };
+
+
+    /**
+     * @brief   Coefficients of one Second Order Section (a0 = 1)
+     */
+    struct MlxSOSCoefficients
+    {
+        double b0;
+        double b1;
+        double b2;
+        double a1;
+        double a2;
+    };
+
+
+    /**
+     * @brief   Design digital IIR Filter as Cascade of Second Order Sections
+     *
+     *  Same Procedure as scipy.signal.iirfilter(..., output='sos'): analog Prototype,
+     *  Frequency Transformation on prewarped Edges, Bilinear Transform and
+     *  nearest Pole/Zero Pairing. The Gain is put into the first Section.
+     *
+     * @param spec  Design Parameters
+     * @param sos   Resulting Sections
+     * @return      false if the Parameters are invalid
+     */
+    bool designIIR(const MlxIIRDesignSpec &spec, std::vector<MlxSOSCoefficients> &sos);
+
+
+}   /* namespace mlx */
@@ -0,0 +1,293 @@
+/**
+ * @file    mlx-lifting-dwt.cc
+ * @brief   In-place Discrete Wavelet Transform by Lifting Steps
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#include "mlx-lifting-dwt.h"
+#include "mlx-cpu-features.h"
+
+#include <math.h>
+#include <algorithm>
+
+
+namespace mlx
+{
+
+    namespace
+    {
+        /* x[i] += c0 y0[i] + c1 y1[i] */
+        inline __attribute__((always_inline))
+        void _mlx_lift_axpy(double *x, const double *y0, const double *y1, size_t n, double c0, double c1)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                x[i] += (c0 * y0[i]) + (c1 * y1[i]);
+            }
+        }
+
+
+#ifdef MLX_X86_DISPATCH
+        __attribute__((target("avx2,fma")))
+        void _mlx_lift_axpy_avx2(double *x, const double *y0, const double *y1, size_t n, double c0, double c1)
+        {
+            _mlx_lift_axpy(x, y0, y1, n, c0, c1);
+        }
+#endif
+    }
+
+
+
+    MlxLiftingDWT::MlxLiftingDWT(WaveletTemplate_t family, size_t member, size_t length)
+    : _length(length)
+    , _steps {}
+    , _count(0)
+    , _ks(1.0)
+    , _kd(1.0)
+    , _shift(0)
+    , _scratch(length / 2)
+    , _valid(false)
+    , _avx2(mlxCpuHasAvx2Fma())
+    {
+        const double r3 = sqrt(3.0);
+
+        if (((family == GSL_WAVELET_HAAR) && (member == 2)) || ((family == GSL_WAVELET_DAUBECHIES) && (member == 2)))
+        {
+            // d = o - e, s = e + d / 2
+            _steps[0] = { true, -1.0, 0, 0.0, 0 };
+            _steps[1] = { false, 0.5, 0, 0.0, 0 };
+            _count = 2;
+
+            _ks = M_SQRT2;
+            _kd = -M_SQRT1_2;
+            _valid = true;
+        }
+        else if ((family == GSL_WAVELET_DAUBECHIES) && (member == 4))
+        {
+            // Daubechies & Sweldens Factorization of D4, aligned to GSL's Filter Phase
+            _steps[0] = { false, r3, 0, 0.0, 0 };
+            _steps[1] = { true, -r3 / 4.0, 0, -(r3 - 2.0) / 4.0, -1 };
+            _steps[2] = { false, -1.0, 1, 0.0, 0 };
+            _count = 3;
+
+            _ks = (r3 - 1.0) / M_SQRT2;
+            _kd = -(r3 + 1.0) / M_SQRT2;
+            _shift = 1;
+            _valid = true;
+        }
+        else if ((family == GLS_WAVELET_BSPLINE) && (member == 202))
+        {
+            // CDF 5/3: d = o - (e[i] + e[i + 1]) / 2, s = e + (d[i - 1] + d[i]) / 4
+            _steps[0] = { true, -0.5, 0, -0.5, 1 };
+            _steps[1] = { false, 0.25, -1, 0.25, 0 };
+            _count = 2;
+
+            _ks = M_SQRT2;
+            _kd = M_SQRT1_2;
+            _valid = true;
+        }
+    }
+
+
+    MlxLiftingDWT::~MlxLiftingDWT()
+    {
+    }
+
+
+    bool MlxLiftingDWT::valid() const
+    {
+        return _valid;
+    }
+
+
+    size_t MlxLiftingDWT::length() const
+    {
+        return _length;
+    }
+
+
+    size_t MlxLiftingDWT::maxLevels(size_t length)
+    {
+        size_t levels = 0;
+
+        while ((length >= 2) && ((length % 2) == 0))
+        {
+            length /= 2;
+            levels++;
+        }
+
+        return levels;
+    }
+
+
+    bool MlxLiftingDWT::supported(WaveletTemplate_t family, size_t member)
+    {
+        return MlxLiftingDWT(family, member, 0).valid();
+    }
+
+
+    bool MlxLiftingDWT::forward(double *data, size_t n, size_t levels)
+    {
+        if (!_levels(n, levels)) return false;
+
+        for (size_t l = 0; l < levels; l++)
+        {
+            _forwardLevel(data, (n >> l) / 2);
+        }
+
+        return true;
+    }
+
+
+    bool MlxLiftingDWT::inverse(double *data, size_t n, size_t levels)
+    {
+        if (!_levels(n, levels)) return false;
+
+        for (size_t l = levels; l > 0; l--)
+        {
+            _inverseLevel(data, (n >> (l - 1)) / 2);
+        }
+
+        return true;
+    }
+
+
+    bool MlxLiftingDWT::_levels(size_t n, size_t &levels) const
+    {
+        if (!_valid || (n > _length)) return false;
+
+        const size_t available = maxLevels(n);
+        if (levels == 0) levels = available;
+
+        return (levels <= available);
+    }
+
+
+    /* [x_0 ... x_2h-1] -> [s_0 ... s_h-1 | d_0 ... d_h-1] */
+    void MlxLiftingDWT::_forwardLevel(double *data, size_t h)
+    {
+        double *even = data;
+        double *odd = _scratch.data();
+
+        for (size_t i = 0; i < h; i++)
+        {
+            odd[i] = data[(2 * i) + 1];
+            even[i] = data[2 * i];
+        }
+
+        for (size_t s = 0; s < _count; s++)
+        {
+            _lift(_steps[s], even, odd, h, 1.0);
+        }
+
+        for (size_t i = 0; i < h; i++)
+        {
+            even[i] *= _ks;
+        }
+
+        // Detail Half rotated left by _shift (odd[(i + shift) mod h])
+        const size_t shift = _shift % h;
+        double *detail = data + h;
+
+        for (size_t i = 0; i < (h - shift); i++)
+        {
+            detail[i] = _kd * odd[i + shift];
+        }
+
+        for (size_t i = h - shift; i < h; i++)
+        {
+            detail[i] = _kd * odd[i + shift - h];
+        }
+    }
+
+
+    void MlxLiftingDWT::_inverseLevel(double *data, size_t h)
+    {
+        double *even = data;
+        double *odd = _scratch.data();
+
+        const double ks = 1.0 / _ks;
+        const double kd = 1.0 / _kd;
+
+        const size_t shift = _shift % h;
+        const double *detail = data + h;
+
+        for (size_t i = 0; i < (h - shift); i++)
+        {
+            odd[i + shift] = kd * detail[i];
+        }
+
+        for (size_t i = h - shift; i < h; i++)
+        {
+            odd[i + shift - h] = kd * detail[i];
+        }
+
+        for (size_t i = 0; i < h; i++)
+        {
+            even[i] *= ks;
+        }
+
+        for (size_t s = _count; s > 0; s--)
+        {
+            _lift(_steps[s - 1], even, odd, h, -1.0);
+        }
+
+        // descending, so no even Sample is overwritten before it is moved
+        for (size_t i = h; i > 0; i--)
+        {
+            data[2 * (i - 1)] = even[i - 1];
+            data[(2 * (i - 1)) + 1] = odd[i - 1];
+        }
+    }
+
+
+    void MlxLiftingDWT::_lift(const MlxLiftingStep &step, double *even, double *odd, size_t h, double sign) const
+    {
+        double *x = step.detail ? odd : even;
+        const double *y = step.detail ? even : odd;
+
+        const double c0 = sign * step.c0;
+        const double c1 = sign * step.c1;
+
+        // periodic Edges
+        auto edge = [&](size_t i)
+        {
+            const size_t i0 = (i + h + step.k0) % h;
+            const size_t i1 = (i + h + step.k1) % h;
+
+            x[i] += (c0 * y[i0]) + (c1 * y[i1]);
+        };
+
+        edge(0);
+        if (h < 2) return;
+
+        edge(h - 1);
+        if (h < 3) return;
+
+        // Interior: i + k stays in [0, h) for k in {-1, 0, 1}
+        const double *y0 = y + 1 + step.k0;
+        const double *y1 = y + 1 + step.k1;
+
+#ifdef MLX_X86_DISPATCH
+        if (_avx2)
+        {
+            _mlx_lift_axpy_avx2(x + 1, y0, y1, h - 2, c0, c1);
+            return;
+        }
+#endif
+
+        _mlx_lift_axpy(x + 1, y0, y1, h - 2, c0, c1);
+    }
+
+
+}   /* namespace mlx */
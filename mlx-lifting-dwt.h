@@ -0,0 +1,138 @@
+/**
+ * @file    mlx-lifting-dwt.h
+ * @brief   In-place Discrete Wavelet Transform by Lifting Steps
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include "mlx-wavelet-registry.h"
+
+
+namespace mlx
+{
+
+    /* Lifting Steps of the longest supported Scheme */
+    static const size_t MLX_LIFTING_MAX_STEPS = 4;
+
+
+    /**
+     * @brief   One Lifting Step: x[i] += c0 y[i + k0] + c1 y[i + k1], periodic
+     *
+     *  x and y are the even (Approximation) or odd (Detail) Half of one Level.
+     */
+    struct MlxLiftingStep
+    {
+        bool detail;        // true: x = odd Half, y = even Half
+        double c0;
+        int k0;
+        double c1;
+        int k1;
+    };
+
+
+    /**
+     * @brief   Multilevel DWT in the Caller's Buffer (periodic Boundaries)
+     *
+     *  A Level splits its Samples into even and odd Halves, applies the Scheme's
+     *  Predict / Update Steps on the contiguous Halves (AVX2 Kernels chosen at Runtime)
+     *  and scales them. The Output Layout is GSL's: [s_J | d_J | ... | d_1], the only
+     *  extra Buffer is one Half Level of Scratch. Roughly half the Arithmetic of the
+     *  Filter Bank Form.
+     *
+     *  Supported (Family, Member):
+     *      Haar 2, Daubechies 2 / 4    - same Coefficients as GSL (non-centered)
+     *      B-Spline 202                - CDF 5/3 (LeGall), Scaling sqrt(2) / 1 / sqrt(2)
+     *
+     *  The Subset is deliberate: these Members have short closed-form Factorizations that
+     *  reproduce GSL's Coefficients and Phase. Daubechies 6 ... 20, the centered Variants
+     *  and the other B-Splines would need Steps from a numerical Euclidean Factorization,
+     *  whose Coefficients grow and lose Accuracy with the Filter Length. supported() is
+     *  false for them, MlxWaveletTransformation and MlxBatchWaveletDenoiser then keep
+     *  their Filter Bank Path.
+     */
+    class MlxLiftingDWT
+    {
+    public:
+
+        /**
+         * @brief   Create Transform, check valid() before use
+         *
+         * @param family    Wavelet Family
+         * @param member    Family Member
+         * @param length    largest Signal Length
+         */
+        MlxLiftingDWT(WaveletTemplate_t family, size_t member, size_t length);
+        ~MlxLiftingDWT();
+
+
+        bool valid() const;
+        size_t length() const;
+
+        /**
+         * @brief   Number of Levels available for a Length (halving while even)
+         */
+        static size_t maxLevels(size_t length);
+
+        static bool supported(WaveletTemplate_t family, size_t member);
+
+
+        /**
+         * @brief   In-place Decomposition
+         *
+         * @param data      n Samples, replaced by the Coefficients
+         * @param n         Number of Samples (<= length())
+         * @param levels    Number of Levels, 0 for maxLevels(n)
+         * @return          false if n is too long or not divisible by 2^levels
+         */
+        bool forward(double *data, size_t n, size_t levels = 0);
+
+        /**
+         * @brief   In-place Reconstruction (same n and levels as forward)
+         */
+        bool inverse(double *data, size_t n, size_t levels = 0);
+
+
+    protected:
+
+        bool _levels(size_t n, size_t &levels) const;
+
+        void _forwardLevel(double *data, size_t h);
+        void _inverseLevel(double *data, size_t h);
+
+        void _lift(const MlxLiftingStep &step, double *even, double *odd, size_t h, double sign) const;
+
+        const size_t _length;
+
+        MlxLiftingStep _steps[MLX_LIFTING_MAX_STEPS];
+        size_t _count;
+
+        // Output Scaling, the Detail Half is rotated left by _shift
+        double _ks;
+        double _kd;
+        size_t _shift;
+
+        // odd Half of one Level
+        std::vector<double> _scratch;
+
+        bool _valid;
+        bool _avx2;
+
+
+    };  /* MlxLiftingDWT */
+
+
+}   /* namespace mlx */
@@ -0,0 +1,258 @@
+/**
+ * @file    mlx-parallel-sos-filter.cc
+ * @brief   Parallel-in-Time SOS Filtering of long Signals
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-parallel-sos-filter.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+namespace mlx
+{
+
+    /* Number of Samples between two Decay Checks of the Boundary Correction */
+    static const size_t MLX_PARALLEL_SOS_DECAY_CHECK = 64;
+
+
+    static void _matmul(const std::vector<double> &A, const std::vector<double> &B, std::vector<double> &C, size_t D)
+    {
+        std::fill(C.begin(), C.end(), 0.0);
+
+        for (size_t i = 0; i < D; i++)
+        {
+            for (size_t k = 0; k < D; k++)
+            {
+                const double a = A[(i * D) + k];
+                if (a == 0.0) continue;
+
+                for (size_t j = 0; j < D; j++) C[(i * D) + j] += a * B[(k * D) + j];
+            }
+        }
+    }
+
+
+    MlxParallelSOSFilter::MlxParallelSOSFilter(std::shared_ptr<MlxSOSFilter> filter)
+    : MlxParallelSOSFilter(filter, MlxThreadPool::global())
+    {
+    }
+
+
+    MlxParallelSOSFilter::MlxParallelSOSFilter(std::shared_ptr<MlxSOSFilter> filter, MlxThreadPool &pool, size_t minChunk)
+    : _filter(filter)
+    , _pool(pool)
+    , _minChunk(std::max<size_t>(1, minChunk))
+    {
+    }
+
+
+    MlxParallelSOSFilter::~MlxParallelSOSFilter()
+    {
+    }
+
+
+    void MlxParallelSOSFilter::filter(double *data, size_t n)
+    {
+        filter(data, data, n);
+    }
+
+
+    void MlxParallelSOSFilter::filter(const double *in, double *out, size_t n)
+    {
+        const size_t S = _filter->stages();
+        const size_t D = 2 * S;
+        const size_t P = std::min(_pool.size(), n / _minChunk);
+
+        if ((S == 0) || (P <= 1))
+        {
+            _filter->filter(in, out, n);
+            return;
+        }
+
+        if ((_chunks.size() != P) || (_chunks.front().stages() != S))
+        {
+            _chunks.assign(P, *_filter);
+            _final.assign(P, std::vector<double>(D));
+            _start.assign(P + 1, std::vector<double>(D));
+        }
+
+        if (_M.size() != (D * D))
+        {
+            _transition();
+        }
+
+        // Current State of the wrapped Filter is the State at the first Boundary
+        const std::vector<MlxSOSFilterStage>& stages = _filter->getStages();
+        for (size_t s = 0; s < S; s++)
+        {
+            stages[s].getState(_start[0][2 * s], _start[0][(2 * s) + 1]);
+        }
+
+        // 1) Zero-State Response of every Chunk
+        _pool.parallelFor(P, [&](size_t c)
+        {
+            const size_t b = (c * n) / P;
+            const size_t e = ((c + 1) * n) / P;
+
+            MlxSOSFilter &fil = _chunks[c];
+            fil.reset();
+            fil.filter(in + b, out + b, e - b);
+
+            const std::vector<MlxSOSFilterStage>& fs = fil.getStages();
+            for (size_t s = 0; s < S; s++)
+            {
+                fs[s].getState(_final[c][2 * s], _final[c][(2 * s) + 1]);
+            }
+        });
+
+        // 2) Scan over the affine Boundary Maps: s_(c+1) = M^L_c * s_c + f_c
+        _matrix_t ML;
+        size_t lastL = 0;
+
+        for (size_t c = 0; c < P; c++)
+        {
+            const size_t L = (((c + 1) * n) / P) - ((c * n) / P);
+
+            if (L != lastL)
+            {
+                _power(L, ML);
+                lastL = L;
+            }
+
+            for (size_t i = 0; i < D; i++)
+            {
+                double acc = _final[c][i];
+                for (size_t j = 0; j < D; j++) acc += ML[(i * D) + j] * _start[c][j];
+                _start[c + 1][i] = acc;
+            }
+        }
+
+        for (size_t s = 0; s < S; s++)
+        {
+            _filter->setStageState(s, _start[P][2 * s], _start[P][(2 * s) + 1]);
+        }
+
+        // 3) Add zero-Input Response of the Boundary States
+        _pool.parallelFor(P, [&](size_t c)
+        {
+            const size_t b = (c * n) / P;
+            const size_t e = ((c + 1) * n) / P;
+
+            _correct(out + b, e - b, _start[c]);
+        });
+    }
+
+
+    void MlxParallelSOSFilter::_transition()
+    {
+        const std::vector<MlxSOSFilterStage>& stages = _filter->getStages();
+        const size_t S = stages.size();
+        const size_t D = 2 * S;
+
+        _M.assign(D * D, 0.0);
+
+        // Column j: one zero-Input Step from the j-th unit State
+        for (size_t j = 0; j < D; j++)
+        {
+            std::vector<double> st(D, 0.0);
+            st[j] = 1.0;
+
+            double x = 0.0;
+
+            for (size_t s = 0; s < S; s++)
+            {
+                const MlxSOSFilterStage& fil = stages[s];
+                const double y = st[2 * s] + (fil.b0() * x);
+
+                st[2 * s] = st[(2 * s) + 1] + (fil.b1() * x) - (fil.a1() * y);
+                st[(2 * s) + 1] = (fil.b2() * x) - (fil.a2() * y);
+
+                x = y;
+            }
+
+            for (size_t i = 0; i < D; i++) _M[(i * D) + j] = st[i];
+        }
+    }
+
+
+    void MlxParallelSOSFilter::_power(size_t L, _matrix_t &res)
+    {
+        const size_t D = 2 * _filter->stages();
+
+        _matrix_t base = _M;
+        _matrix_t tmp(D * D);
+
+        res.assign(D * D, 0.0);
+        for (size_t i = 0; i < D; i++) res[(i * D) + i] = 1.0;
+
+        while (L > 0)
+        {
+            if (L & 1)
+            {
+                _matmul(res, base, tmp, D);
+                res.swap(tmp);
+            }
+
+            L >>= 1;
+
+            if (L > 0)
+            {
+                _matmul(base, base, tmp, D);
+                base.swap(tmp);
+            }
+        }
+    }
+
+
+    void MlxParallelSOSFilter::_correct(double *out, size_t n, std::vector<double> &state) const
+    {
+        const std::vector<MlxSOSFilterStage>& stages = _filter->getStages();
+        const size_t S = stages.size();
+
+        double norm = 0.0;
+        for (const double& v : state) norm = std::max(norm, fabs(v));
+
+        if (norm == 0.0) return;
+
+        const double limit = norm * MLX_PARALLEL_SOS_TOLERANCE;
+
+        for (size_t k = 0; k < n; k++)
+        {
+            double x = 0.0;
+
+            for (size_t s = 0; s < S; s++)
+            {
+                const MlxSOSFilterStage& fil = stages[s];
+                const double y = state[2 * s] + (fil.b0() * x);
+
+                state[2 * s] = state[(2 * s) + 1] + (fil.b1() * x) - (fil.a1() * y);
+                state[(2 * s) + 1] = (fil.b2() * x) - (fil.a2() * y);
+
+                x = y;
+            }
+
+            out[k] += x;
+
+            if (((k + 1) % MLX_PARALLEL_SOS_DECAY_CHECK) == 0)
+            {
+                double cur = 0.0;
+                for (const double& v : state) cur = std::max(cur, fabs(v));
+
+                if (cur < limit) return;
+            }
+        }
+    }
+
+
+}   /* namespace mlx */
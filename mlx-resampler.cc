@@ -0,0 +1,225 @@
+/**
+ * @file    mlx-resampler.cc
+ * @brief   Polyphase rational Resampler / Decimator
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-resampler.h"
+
+#include <numeric>
+#include <algorithm>
+#include <math.h>
+
+
+namespace mlx
+{
+
+    /* Modified Bessel Function of the first Kind, Order 0 (Power Series) */
+    static double _besselI0(double x)
+    {
+        double sum = 1.0;
+        double term = 1.0;
+        const double q = 0.25 * x * x;
+
+        for (size_t k = 1; k < 500; k++)
+        {
+            term *= q / (double) (k * k);
+            sum += term;
+
+            if (term < (sum * 1.0e-17)) break;
+        }
+
+        return sum;
+    }
+
+
+    /* Kaiser windowed Sinc Lowpass, Cutoff relative to Nyquist, unit DC Gain (as scipy firwin) */
+    static std::vector<double> _designLowpass(size_t N, double cutoff, double beta)
+    {
+        std::vector<double> h(N);
+
+        const double alpha = 0.5 * (N - 1);
+        const double norm = _besselI0(beta);
+        double sum = 0.0;
+
+        for (size_t n = 0; n < N; n++)
+        {
+            const double m = n - alpha;
+            const double x = cutoff * m;
+            const double sinc = (x == 0.0) ? 1.0 : sin(M_PI * x) / (M_PI * x);
+            const double r = (alpha > 0.0) ? (m / alpha) : 0.0;
+            const double w = _besselI0(beta * sqrt(std::max(0.0, 1.0 - (r * r)))) / norm;
+
+            h[n] = cutoff * sinc * w;
+            sum += h[n];
+        }
+
+        for (double& v : h) v /= sum;
+
+        return h;
+    }
+
+
+    MlxPolyphaseResampler::MlxPolyphaseResampler(size_t up, size_t down, size_t halfLen, double beta)
+    {
+        const size_t g = std::gcd(std::max<size_t>(up, 1), std::max<size_t>(down, 1));
+        const size_t L = std::max<size_t>(up, 1) / g;
+        const size_t M = std::max<size_t>(down, 1) / g;
+        const size_t rate = std::max(L, M);
+        const size_t half = halfLen * rate;
+
+        std::vector<double> h = _designLowpass((2 * half) + 1, 1.0 / rate, beta);
+        for (double& v : h) v *= L;
+
+        _init(L, M, h);
+    }
+
+
+    MlxPolyphaseResampler::MlxPolyphaseResampler(size_t up, size_t down, const std::vector<double> &taps)
+    {
+        const size_t g = std::gcd(std::max<size_t>(up, 1), std::max<size_t>(down, 1));
+
+        _init(std::max<size_t>(up, 1) / g, std::max<size_t>(down, 1) / g, taps);
+    }
+
+
+    MlxPolyphaseResampler::~MlxPolyphaseResampler()
+    {
+    }
+
+
+    void MlxPolyphaseResampler::_init(size_t up, size_t down, std::vector<double> taps)
+    {
+        _up = up;
+        _down = down;
+
+        if (taps.empty()) taps.push_back(1.0);
+
+        // Leading Zeros make the Group Delay a whole Number of Output Samples
+        const size_t half = (taps.size() - 1) / 2;
+        const size_t pad = (_down - (half % _down)) % _down;
+
+        taps.insert(taps.begin(), pad, 0.0);
+
+        _delay = (half + pad) / _down;
+        _taps = (taps.size() + _up - 1) / _up;
+
+        _phases.assign(_up * _taps, 0.0);
+
+        for (size_t p = 0; p < _up; p++)
+        {
+            for (size_t k = 0; k < _taps; k++)
+            {
+                const size_t idx = p + (k * _up);
+                if (idx < taps.size()) _phases[(p * _taps) + (_taps - 1 - k)] = taps[idx];
+            }
+        }
+
+        reset();
+    }
+
+
+    size_t MlxPolyphaseResampler::up() const
+    {
+        return _up;
+    }
+
+
+    size_t MlxPolyphaseResampler::down() const
+    {
+        return _down;
+    }
+
+
+    size_t MlxPolyphaseResampler::delay() const
+    {
+        return _delay;
+    }
+
+
+    size_t MlxPolyphaseResampler::maxOutput(size_t n) const
+    {
+        return ((n * _up) / _down) + 1;
+    }
+
+
+    void MlxPolyphaseResampler::reset()
+    {
+        _buf.assign(_taps - 1, 0.0);
+        _t = 0;
+    }
+
+
+    size_t MlxPolyphaseResampler::process(const double *in, size_t n, double *out)
+    {
+        const size_t H = _taps - 1;
+
+        _buf.resize(H + n);
+        std::copy(in, in + n, _buf.begin() + H);
+
+        size_t produced = 0;
+
+        // Output at upsampled Position t uses Phase t % L and Inputs up to t / L
+        while ((_t / _up) < n)
+        {
+            const size_t base = _t / _up;
+            const double *ph = &_phases[(_t % _up) * _taps];
+            const double *xp = &_buf[base];
+
+            double acc = 0.0;
+            for (size_t j = 0; j < _taps; j++) acc += ph[j] * xp[j];
+
+            out[produced++] = acc;
+            _t += _down;
+        }
+
+        _t -= n * _up;
+
+        // Keep the last H Samples as History
+        std::copy(_buf.end() - H, _buf.end(), _buf.begin());
+        _buf.resize(H);
+
+        return produced;
+    }
+
+
+    void MlxPolyphaseResampler::resample(const double *in, size_t n, std::vector<double> &out)
+    {
+        // len + delay - 1 below underflows for n = 0 and delay 0
+        if (n == 0)
+        {
+            out.clear();
+            reset();
+            return;
+        }
+
+        const size_t len = ((n * _up) + _down - 1) / _down;
+
+        // Zeros needed so that Output (len + delay - 1) has all its Inputs
+        const size_t last = (((len + _delay) * _down) - _down) / _up;
+        const size_t zeros = (last >= n) ? (last + 1 - n) : 0;
+
+        std::vector<double> tail(zeros, 0.0);
+        std::vector<double> tmp(maxOutput(n) + maxOutput(zeros));
+
+        reset();
+
+        size_t produced = process(in, n, tmp.data());
+        produced += process(tail.data(), zeros, tmp.data() + produced);
+
+        out.assign(tmp.begin() + _delay, tmp.begin() + _delay + len);
+
+        reset();
+    }
+
+
+}   /* namespace mlx */
@@ -0,0 +1,134 @@
+/**
+ * @file    mlx-resampler.h
+ * @brief   Polyphase rational Resampler / Decimator
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "structures/mlx-vector.h"
+
+
+namespace mlx
+{
+
+    /* Anti-Aliasing Filter: Half Length per max(L, M) and Kaiser Beta (as scipy resample_poly) */
+    static const size_t MLX_RESAMPLER_HALF_LENGTH = 10;
+    static const double MLX_RESAMPLER_KAISER_BETA = 5.0;
+
+
+    /**
+     * @brief   Resamples by the rational Factor L / M with a polyphase FIR
+     *
+     *  Only the kept Output Samples are computed: Output m is the Dot Product of one
+     *  Filter Phase with the Input History, so neither the zero-stuffed nor the
+     *  full-Rate filtered Signal is ever formed. The Anti-Aliasing Filter is a Kaiser
+     *  windowed Sinc with Cutoff at the lower of both Nyquist Frequencies.
+     *
+     *  process() is streaming: the Input History is kept between Calls, the Output
+     *  lags the Input by delay() Output Samples.
+     */
+    class MlxPolyphaseResampler
+    {
+    public:
+
+        /**
+         * @brief   Create Resampler with designed Anti-Aliasing Filter
+         *
+         * @param up        Interpolation Factor L
+         * @param down      Decimation Factor M
+         * @param halfLen   Filter Half Length in Units of max(L, M)
+         * @param beta      Kaiser Window Beta
+         */
+        MlxPolyphaseResampler(size_t up, size_t down, size_t halfLen = MLX_RESAMPLER_HALF_LENGTH, double beta = MLX_RESAMPLER_KAISER_BETA);
+
+        /**
+         * @brief   Create Resampler with user Filter (designed for the upsampled Rate, Gain L)
+         *
+         * @param up        Interpolation Factor L
+         * @param down      Decimation Factor M
+         * @param taps      FIR Coefficients
+         */
+        MlxPolyphaseResampler(size_t up, size_t down, const std::vector<double> &taps);
+
+        ~MlxPolyphaseResampler();
+
+
+        size_t up() const;
+        size_t down() const;
+
+        /**
+         * @brief   Group Delay of the Filter in Output Samples
+         */
+        size_t delay() const;
+
+        /**
+         * @brief   Upper Bound of Outputs produced by process() for n Inputs
+         */
+        size_t maxOutput(size_t n) const;
+
+
+        /**
+         * @brief   Streaming Resampling
+         *
+         * @param in    Input Samples
+         * @param n     Number of Input Samples
+         * @param out   Output Buffer, at least maxOutput(n) Samples
+         * @return      Number of Output Samples written
+         */
+        size_t process(const double *in, size_t n, double *out);
+
+
+        /**
+         * @brief   Resample a whole Signal, Filter Delay is compensated
+         *
+         * @param in    Input Samples
+         * @param n     Number of Input Samples
+         * @param out   Output Signal, ceil(n * L / M) Samples (empty for n = 0)
+         */
+        void resample(const double *in, size_t n, std::vector<double> &out);
+
+
+        /**
+         * @brief   Clear Input History
+         *
+         */
+        void reset();
+
+
+    protected:
+
+        void _init(size_t up, size_t down, std::vector<double> taps);
+
+        size_t _up;
+        size_t _down;
+        size_t _taps;       // Taps per Phase
+        size_t _delay;      // in Output Samples
+
+        // Phase p reversed: _phases[p * _taps + j] = h[p + (_taps - 1 - j) * L]
+        std::vector<double> _phases;
+
+        // Input History (_taps - 1 Samples) followed by the current Block
+        std::vector<double> _buf;
+
+        // Upsampled Position of the next Output relative to the current Block
+        size_t _t;
+
+
+    };  /* MlxPolyphaseResampler */
+
+
+}   /* namespace mlx */
@@ -0,0 +1,410 @@
+/**
+ * @file    mlx-scalogram.cc
+ * @brief   FFT-based Continuous Wavelet Transform over a Set of Scales
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#include "mlx-scalogram.h"
+
+#include <math.h>
+#include <atomic>
+#include <algorithm>
+
+
+namespace mlx
+{
+
+    MlxContinuousWaveletTransform::MlxContinuousWaveletTransform(size_t length, const std::vector<double> &scales, CWTWavelet_t wavelet, double param,
+        bool pad, MlxThreadPool &pool, MlxFFTPlanCache &cache)
+    : _length(length)
+    , _wavelet(wavelet)
+    , _param((param > 0.0) ? param : ((wavelet == MLX_CWT_MORLET) ? 6.0 : 2.0))
+    , _fftLength(0)
+    , _scales(scales)
+    , _pool(pool)
+    , _cache(cache)
+    , _ur(1.0)
+    , _ui(0.0)
+    {
+        if (_length == 0) return;
+
+        for (double s : _scales)
+        {
+            if (!(s > 0.0)) return;
+        }
+
+        const size_t L = pad ? fftFastLength(2 * _length) : _length;
+        const size_t half = L / 2;
+
+        // Wavelets wider than the Transform would wrap around entirely
+        for (double s : _scales)
+        {
+            if (s > L) return;
+        }
+
+        // DoG Order, the Mexican Hat is the 2nd Derivative
+        const int m = (_wavelet == MLX_CWT_MEXICAN_HAT) ? 2 : int(lround(_param));
+        if ((_wavelet != MLX_CWT_MORLET) && (m < 1)) return;
+
+        double norm = pow(M_PI, -0.25);
+
+        if (_wavelet != MLX_CWT_MORLET)
+        {
+            // conj(-(i^m))
+            static const double ur[4] = { -1.0, 0.0, 1.0, 0.0 };
+            static const double ui[4] = { 0.0, 1.0, 0.0, -1.0 };
+
+            _ur = ur[m % 4];
+            _ui = ui[m % 4];
+            norm = 1.0 / sqrt(tgamma(m + 0.5));
+        }
+        else
+        {
+            // Real and imaginary Part are inverse Transforms of Z / 2 and -i Z / 2
+            norm *= 0.5;
+        }
+
+        std::vector<double> psi(half + 1);
+
+        for (size_t j = 0; j < _scales.size(); j++)
+        {
+            const double s = _scales[j];
+            const double gain = norm * sqrt(2.0 * M_PI * s);
+            double peak = 0.0;
+
+            for (size_t k = 0; k <= half; k++)
+            {
+                const double sw = (2.0 * M_PI * s * k) / L;
+
+                if (_wavelet == MLX_CWT_MORLET)
+                {
+                    // one-sided, no DC and Nyquist Term
+                    const bool inner = (k > 0) && ((2 * k) < L);
+                    psi[k] = inner ? (gain * exp(-0.5 * (sw - _param) * (sw - _param))) : 0.0;
+                }
+                else
+                {
+                    psi[k] = gain * pow(sw, m) * exp(-0.5 * sw * sw);
+                }
+
+                peak = std::max(peak, psi[k]);
+            }
+
+            // Morlet Bins exclude DC and Nyquist, _scale() reads their Neighbours
+            size_t first = (_wavelet == MLX_CWT_MORLET) ? 1 : 0;
+            size_t last = (_wavelet == MLX_CWT_MORLET) ? ((L + 1) / 2) : (half + 1);
+            const double cutoff = MLX_CWT_SPECTRUM_CUTOFF * peak;
+
+            while ((first < last) && (psi[first] < cutoff)) first++;
+            while ((last > first) && (psi[last - 1] < cutoff)) last--;
+
+            // underflowed Spectrum (Scale far beyond the Band of the Transform): empty Band
+            if (!(peak > 0.0)) last = first;
+
+            _first.push_back(first);
+            _count.push_back(last - first);
+            _offset.push_back(_psi.size());
+            _psi.insert(_psi.end(), psi.begin() + first, psi.begin() + last);
+        }
+
+        _spec.resize(L);
+
+        const size_t workers = std::max<size_t>(1, std::min(_pool.size(), _scales.size()));
+        _scratch.assign(workers, std::vector<double>(2 * L));
+
+        _fftLength = L;
+    }
+
+
+    MlxContinuousWaveletTransform::~MlxContinuousWaveletTransform()
+    {
+    }
+
+
+    size_t MlxContinuousWaveletTransform::length() const
+    {
+        return _length;
+    }
+
+
+    size_t MlxContinuousWaveletTransform::scales() const
+    {
+        return _scales.size();
+    }
+
+
+    size_t MlxContinuousWaveletTransform::fftLength() const
+    {
+        return _fftLength;
+    }
+
+
+    double MlxContinuousWaveletTransform::scale(size_t idx) const
+    {
+        return _scales[idx];
+    }
+
+
+    double MlxContinuousWaveletTransform::frequency(size_t idx, double fs) const
+    {
+        return (fs * _fourierFactor(_wavelet, _param)) / _scales[idx];
+    }
+
+
+    bool MlxContinuousWaveletTransform::complex() const
+    {
+        return (_wavelet == MLX_CWT_MORLET);
+    }
+
+
+    bool MlxContinuousWaveletTransform::transform(const double *in, double *re, double *im)
+    {
+        if (re == nullptr) return false;
+        if ((im == nullptr) && complex()) return false;
+
+        return _run(in, re, im, &MlxContinuousWaveletTransform::_coefficients);
+    }
+
+
+    bool MlxContinuousWaveletTransform::magnitude(const double *in, double *out)
+    {
+        if (out == nullptr) return false;
+
+        return _run(in, out, nullptr, &MlxContinuousWaveletTransform::_magnitude);
+    }
+
+
+    std::shared_ptr<MlxFixedMatrix<double>> MlxContinuousWaveletTransform::magnitude(const double *in)
+    {
+        std::shared_ptr<MlxFixedMatrix<double>> res = std::make_shared<MlxFixedMatrix<double>>(_scales.size(), _length);
+        if (!magnitude(in, res->data())) return nullptr;
+
+        return res;
+    }
+
+
+    std::vector<double> MlxContinuousWaveletTransform::geometricScales(double s0, double dj, size_t count)
+    {
+        std::vector<double> res(count);
+
+        for (size_t j = 0; j < count; j++)
+        {
+            res[j] = s0 * exp2(j * dj);
+        }
+
+        return res;
+    }
+
+
+    double MlxContinuousWaveletTransform::scaleForFrequency(double f, double fs, CWTWavelet_t wavelet, double param)
+    {
+        return (fs * _fourierFactor(wavelet, param)) / f;
+    }
+
+
+    double MlxContinuousWaveletTransform::minimumScale(CWTWavelet_t wavelet, double param)
+    {
+        const double decay = MLX_CWT_NYQUIST_DECAY;
+
+        // Gaussian around w0 of unit Width: Peak + sqrt(2 decay) at pi
+        if (wavelet == MLX_CWT_MORLET)
+        {
+            const double w0 = (param > 0.0) ? param : 6.0;
+            return (w0 + sqrt(2.0 * decay)) / M_PI;
+        }
+
+        // DoG: |Psi(x)| ~ x^m exp(-x^2 / 2), Peak at sqrt(m), Ratio to the Peak falls beyond it
+        const double m = (wavelet == MLX_CWT_MEXICAN_HAT) ? 2.0 : ((param > 0.0) ? double(lround(param)) : 2.0);
+        double lo = sqrt(m);
+        double hi = lo + (2.0 * sqrt(2.0 * decay));
+
+        for (size_t it = 0; it < 64; it++)
+        {
+            const double x = 0.5 * (lo + hi);
+            const double ratio = (m * log(x / sqrt(m))) - (0.5 * ((x * x) - m));
+
+            if (ratio > -decay) lo = x;
+            else hi = x;
+        }
+
+        return hi / M_PI;
+    }
+
+
+    double MlxContinuousWaveletTransform::_fourierFactor(CWTWavelet_t wavelet, double param)
+    {
+        if (wavelet == MLX_CWT_MORLET)
+        {
+            const double w0 = (param > 0.0) ? param : 6.0;
+            return (w0 + sqrt(2.0 + (w0 * w0))) / (4.0 * M_PI);
+        }
+
+        const double m = (wavelet == MLX_CWT_MEXICAN_HAT) ? 2.0 : ((param > 0.0) ? double(lround(param)) : 2.0);
+        return sqrt(m + 0.5) / (2.0 * M_PI);
+    }
+
+
+    bool MlxContinuousWaveletTransform::_run(const double *in, double *re, double *im, _kernel_t kernel)
+    {
+        if ((_fftLength == 0) || (in == nullptr)) return false;
+
+        const size_t L = _fftLength;
+        const size_t count = _scales.size();
+
+        std::copy(in, in + _length, _spec.begin());
+        std::fill(_spec.begin() + _length, _spec.end(), 0.0);
+
+        if (!_cache.acquire(L)->transform(_spec.data())) return false;
+
+        // Contiguous Blocks of Scales, one Scratch per Worker
+        const size_t workers = (count < MLX_CWT_MIN_PARALLEL) ? 1 : _scratch.size();
+        const size_t block = (count + workers - 1) / workers;
+
+        std::atomic<bool> ok { true };
+
+        auto work = [&](size_t w)
+        {
+            const size_t first = w * block;
+            const size_t last = std::min(count, first + block);
+            if (first >= last) return;
+
+            std::shared_ptr<MlxMixedRadixRealFFT> plan = _cache.acquire(L);
+            double *scratch = _scratch[w].data();
+
+            for (size_t j = first; j < last; j++)
+            {
+                if (!(this->*kernel)(j, *plan, re, im, scratch))
+                {
+                    ok.store(false, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        if (workers == 1)
+        {
+            work(0);
+        }
+        else
+        {
+            _pool.parallelFor(workers, work);
+        }
+
+        return ok.load();
+    }
+
+
+    bool MlxContinuousWaveletTransform::_scale(size_t j, MlxMixedRadixRealFFT &plan, double *a, double *b)
+    {
+        const size_t L = _fftLength;
+        const size_t first = _first[j];
+        const size_t last = first + _count[j];
+        const double *psi = _psi.data() + _offset[j];
+        const double *x = _spec.data();
+
+        std::fill(a, a + L, 0.0);
+
+        if (_wavelet == MLX_CWT_MORLET)
+        {
+            // Z = X conj(Psi) is one-sided, a = Z / 2 and b = -i Z / 2 (1/2 folded into Psi)
+            std::fill(b, b + L, 0.0);
+
+            for (size_t k = first; k < last; k++)
+            {
+                const double zr = x[(2 * k) - 1] * psi[k - first];
+                const double zi = x[2 * k] * psi[k - first];
+
+                a[(2 * k) - 1] = zr;
+                a[2 * k] = zi;
+                b[(2 * k) - 1] = zi;
+                b[2 * k] = -zr;
+            }
+
+            return plan.inverse(a) && plan.inverse(b);
+        }
+
+        for (size_t k = first; k < last; k++)
+        {
+            if ((k == 0) || ((2 * k) == L))
+            {
+                // DC and Nyquist are real
+                const size_t idx = (k == 0) ? 0 : (L - 1);
+                a[idx] = x[idx] * psi[k - first] * _ur;
+                continue;
+            }
+
+            const double xr = x[(2 * k) - 1];
+            const double xi = x[2 * k];
+
+            a[(2 * k) - 1] = psi[k - first] * ((xr * _ur) - (xi * _ui));
+            a[2 * k] = psi[k - first] * ((xr * _ui) + (xi * _ur));
+        }
+
+        return plan.inverse(a);
+    }
+
+
+    bool MlxContinuousWaveletTransform::_coefficients(size_t j, MlxMixedRadixRealFFT &plan, double *re, double *im, double *scratch)
+    {
+        const size_t N = _length;
+        double *a = scratch;
+        double *b = scratch + _fftLength;
+
+        if (!_scale(j, plan, a, b)) return false;
+
+        std::copy(a, a + N, re + (j * N));
+
+        if (im != nullptr)
+        {
+            if (complex())
+            {
+                std::copy(b, b + N, im + (j * N));
+            }
+            else
+            {
+                std::fill(im + (j * N), im + ((j + 1) * N), 0.0);
+            }
+        }
+
+        return true;
+    }
+
+
+    bool MlxContinuousWaveletTransform::_magnitude(size_t j, MlxMixedRadixRealFFT &plan, double *out, double * /*im*/, double *scratch)
+    {
+        const size_t N = _length;
+        double *a = scratch;
+        double *b = scratch + _fftLength;
+        double *row = out + (j * N);
+
+        if (!_scale(j, plan, a, b)) return false;
+
+        if (complex())
+        {
+            for (size_t n = 0; n < N; n++)
+            {
+                row[n] = sqrt((a[n] * a[n]) + (b[n] * b[n]));
+            }
+        }
+        else
+        {
+            for (size_t n = 0; n < N; n++)
+            {
+                row[n] = fabs(a[n]);
+            }
+        }
+
+        return true;
+    }
+
+
+}   /* namespace mlx */
@@ -0,0 +1,196 @@
+/**
+ * @file    mlx-scalogram.h
+ * @brief   FFT-based Continuous Wavelet Transform over a Set of Scales
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "structures/mlx-matrix.h"
+#include "mlx-fft-plan-cache.h"
+#include "mlx-thread-pool.h"
+
+
+namespace mlx
+{
+
+    typedef enum {
+        MLX_CWT_MORLET = 1,             // analytic, complex Output, Parameter: w0 (Default 6)
+        MLX_CWT_MEXICAN_HAT = 2,        // real, DoG of Order 2
+        MLX_CWT_DOG = 3,                // real, Parameter: Derivative Order m (Default 2)
+    } CWTWavelet_t;
+
+
+    /* Scales below this Count are transformed on the calling Thread */
+    static const size_t MLX_CWT_MIN_PARALLEL = 4;
+
+    /* Wavelet Spectrum Values below this Fraction of the Peak are dropped */
+    static const double MLX_CWT_SPECTRUM_CUTOFF = 1e-12;
+
+    /* Smallest Scale: Wavelet Spectrum at Nyquist down to exp(-MLX_CWT_NYQUIST_DECAY) of its Peak */
+    static const double MLX_CWT_NYQUIST_DECAY = 4.5;
+
+
+    /**
+     * @brief   Continuous Wavelet Transform (Torrence & Compo Normalization)
+     *
+     *  The Signal is transformed once; every Scale multiplies the Spectrum with the
+     *  cached Wavelet Spectrum (only the Band above MLX_CWT_SPECTRUM_CUTOFF is kept)
+     *  and runs its inverse Transform, so the Cost is O(S N log N) instead of
+     *  O(N S K) for direct Convolution. Scales are split into contiguous Blocks across
+     *  the Thread Pool, every Worker uses its thread-local Plans and own Scratch.
+     *  Morlet Coefficients are complex: Real and imaginary Part are two real inverse
+     *  Transforms of the one-sided Product. Scales are given in Samples.
+     */
+    class MlxContinuousWaveletTransform
+    {
+    public:
+
+        /**
+         * @brief   Create Transform
+         *
+         * @param length    Signal Length
+         * @param scales    Wavelet Scales in Samples (> 0, at most the padded Transform Length), smaller Scales than minimumScale() are biased
+         * @param wavelet   Mother Wavelet
+         * @param param     Morlet w0 or DoG Order, 0 for the Default
+         * @param pad       zero-pad to the next 5-smooth Length >= 2 length (no circular Wrap-Around)
+         * @param pool      Worker Threads
+         * @param cache     Plan Cache
+         */
+        MlxContinuousWaveletTransform(size_t length, const std::vector<double> &scales, CWTWavelet_t wavelet = MLX_CWT_MORLET, double param = 0.0,
+            bool pad = true, MlxThreadPool &pool = MlxThreadPool::global(), MlxFFTPlanCache &cache = MlxFFTPlanCache::global());
+
+        ~MlxContinuousWaveletTransform();
+
+
+        size_t length() const;
+        size_t scales() const;
+
+        /**
+         * @brief   Transform Length incl. Padding
+         */
+        size_t fftLength() const;
+
+        double scale(size_t idx) const;
+
+        /**
+         * @brief   Equivalent Fourier Frequency of a Scale
+         *
+         * @param idx   Scale Index
+         * @param fs    Sample Frequency
+         */
+        double frequency(size_t idx, double fs) const;
+
+        /**
+         * @brief   true for Morlet (complex Coefficients)
+         */
+        bool complex() const;
+
+
+        /**
+         * @brief   Coefficients, Row j (j * length()) belongs to Scale j
+         *
+         * @param in    length() Samples
+         * @param re    scales() x length() Real Parts
+         * @param im    scales() x length() imaginary Parts, may be nullptr (zero for real Wavelets)
+         * @return      false on Error
+         */
+        bool transform(const double *in, double *re, double *im);
+
+        /**
+         * @brief   Scalogram |W(s, t)|
+         *
+         * @param in    length() Samples
+         * @param out   scales() x length() Values
+         * @return      false on Error
+         */
+        bool magnitude(const double *in, double *out);
+
+        /**
+         * @brief   Scalogram as Matrix (one Row per Scale), nullptr on Error
+         */
+        std::shared_ptr<MlxFixedMatrix<double>> magnitude(const double *in);
+
+
+        /**
+         * @brief   Geometric Scales s0 2^(j dj), j < count
+         *
+         * @param s0        smallest Scale in Samples
+         * @param dj        Spacing in Octaves
+         * @param count     Number of Scales
+         */
+        static std::vector<double> geometricScales(double s0, double dj, size_t count);
+
+        /**
+         * @brief   Scale in Samples whose equivalent Fourier Frequency is f (Inverse of frequency())
+         */
+        static double scaleForFrequency(double f, double fs, CWTWavelet_t wavelet = MLX_CWT_MORLET, double param = 0.0);
+
+        /**
+         * @brief   Smallest Scale in Samples whose Wavelet Spectrum fits below Nyquist
+         *
+         *  The Spectrum at Nyquist has decayed to exp(-MLX_CWT_NYQUIST_DECAY) of its Peak:
+         *  Morlet s = (w0 + 3) / pi, 2.86 Samples or 0.34 fs for w0 = 6.
+         */
+        static double minimumScale(CWTWavelet_t wavelet = MLX_CWT_MORLET, double param = 0.0);
+
+
+    protected:
+
+        /* Frequency x Scale / fs */
+        static double _fourierFactor(CWTWavelet_t wavelet, double param);
+
+        typedef bool (MlxContinuousWaveletTransform::*_kernel_t)(size_t, MlxMixedRadixRealFFT&, double*, double*, double*);
+
+        bool _run(const double *in, double *re, double *im, _kernel_t kernel);
+
+        /* Product of Spectrum and Wavelet of Scale j, inverse Transform into the Worker Scratch */
+        bool _scale(size_t j, MlxMixedRadixRealFFT &plan, double *a, double *b);
+
+        bool _coefficients(size_t j, MlxMixedRadixRealFFT &plan, double *re, double *im, double *scratch);
+        bool _magnitude(size_t j, MlxMixedRadixRealFFT &plan, double *out, double * /*im*/, double *scratch);
+
+        const size_t _length;
+        const CWTWavelet_t _wavelet;
+        const double _param;
+
+        size_t _fftLength;
+        std::vector<double> _scales;
+
+        MlxThreadPool &_pool;
+        MlxFFTPlanCache &_cache;
+
+        // conj(Psi(s w_k)) per Scale for k in [_first[j], _first[j] + _count[j]), from _offset[j]
+        std::vector<double> _psi;
+        std::vector<size_t> _first;
+        std::vector<size_t> _count;
+        std::vector<size_t> _offset;
+
+        // constant Phase of conj(Psi): (_ur + i _ui), DoG only
+        double _ur;
+        double _ui;
+
+        // Half Complex Spectrum of the current Signal
+        std::vector<double> _spec;
+
+        // per Worker [a | b], fftLength() each
+        std::vector<std::vector<double>> _scratch;
+
+
+    };  /* MlxContinuousWaveletTransform */
+
+
+}   /* namespace mlx */
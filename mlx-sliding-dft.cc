@@ -0,0 +1,286 @@
+/**
+ * @file    mlx-sliding-dft.cc
+ * @brief   Sliding DFT Tracker for a small Set of Bins
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-sliding-dft.h"
+#include "mlx-cpu-features.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+namespace mlx
+{
+
+    static std::vector<size_t> _binsForFrequencies(size_t N, double fs, const std::vector<double> &frequencies)
+    {
+        std::vector<size_t> bins;
+
+        for (double f : frequencies)
+        {
+            const double k = (fs > 0.0) ? floor(((f * N) / fs) + 0.5) : 0.0;
+            bins.push_back(size_t(std::max(0.0, k)));
+        }
+
+        return bins;
+    }
+
+
+    namespace
+    {
+        /* Block Sum of Differences times exp(-2 pi i k j / N), 4 partial Sums per Part */
+        inline __attribute__((always_inline))
+        void _mlx_sdft_block(const double *diff, size_t len, const double *tr, const double *ti, double &re, double &im)
+        {
+            double ar[4] = { 0.0, 0.0, 0.0, 0.0 };
+            double ai[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+            size_t j = 0;
+            for (; (j + 4) <= len; j += 4)
+            {
+                for (size_t l = 0; l < 4; l++)
+                {
+                    ar[l] += diff[j + l] * tr[j + l];
+                    ai[l] += diff[j + l] * ti[j + l];
+                }
+            }
+
+            for (; j < len; j++)
+            {
+                ar[0] += diff[j] * tr[j];
+                ai[0] += diff[j] * ti[j];
+            }
+
+            re = (ar[0] + ar[1]) + (ar[2] + ar[3]);
+            im = (ai[0] + ai[1]) + (ai[2] + ai[3]);
+        }
+
+
+#ifdef MLX_X86_DISPATCH
+        __attribute__((target("avx2,fma")))
+        void _mlx_sdft_block_avx2(const double *diff, size_t len, const double *tr, const double *ti, double &re, double &im)
+        {
+            _mlx_sdft_block(diff, len, tr, ti, re, im);
+        }
+#endif
+    }
+
+
+    MlxSlidingDFT::MlxSlidingDFT(size_t N, const std::vector<size_t> &bins)
+    : _length(std::max<size_t>(N, 1))
+    , _bins(bins)
+    , _w(2 * std::max<size_t>(N, 1))
+    , _tr(bins.size() * MLX_SDFT_BLOCK)
+    , _ti(bins.size() * MLX_SDFT_BLOCK)
+    , _history(std::max<size_t>(N, 1))
+    , _sr(bins.size())
+    , _si(bins.size())
+    , _idx(bins.size())
+    , _diff(MLX_SDFT_BLOCK)
+    , _avx2(mlxCpuHasAvx2Fma())
+    {
+        for (size_t& k : _bins) k = std::min(k, _length / 2);
+
+        for (size_t m = 0; m < _length; m++)
+        {
+            const double a = (2.0 * M_PI * m) / _length;
+            _w[2 * m] = cos(a);
+            _w[(2 * m) + 1] = -sin(a);
+        }
+
+        // Twiddles of one Block relative to its first Sample, exact Index k * j mod N
+        for (size_t b = 0; b < _bins.size(); b++)
+        {
+            size_t idx = 0;
+
+            for (size_t j = 0; j < MLX_SDFT_BLOCK; j++)
+            {
+                _tr[(b * MLX_SDFT_BLOCK) + j] = _w[2 * idx];
+                _ti[(b * MLX_SDFT_BLOCK) + j] = _w[(2 * idx) + 1];
+                idx = (idx + _bins[b]) % _length;
+            }
+        }
+
+        reset();
+    }
+
+
+    MlxSlidingDFT::MlxSlidingDFT(size_t N, double fs, const std::vector<double> &frequencies)
+    : MlxSlidingDFT(N, _binsForFrequencies(N, fs, frequencies))
+    {
+    }
+
+
+    MlxSlidingDFT::~MlxSlidingDFT()
+    {
+    }
+
+
+    size_t MlxSlidingDFT::length() const
+    {
+        return _length;
+    }
+
+
+    size_t MlxSlidingDFT::size() const
+    {
+        return _bins.size();
+    }
+
+
+    size_t MlxSlidingDFT::bin(size_t idx) const
+    {
+        return _bins.at(idx);
+    }
+
+
+    void MlxSlidingDFT::reset()
+    {
+        std::fill(_history.begin(), _history.end(), 0.0);
+        std::fill(_sr.begin(), _sr.end(), 0.0);
+        std::fill(_si.begin(), _si.end(), 0.0);
+        std::fill(_idx.begin(), _idx.end(), 0);
+
+        _pos = 0;
+        _samples = 0;
+    }
+
+
+    void MlxSlidingDFT::process(double sample)
+    {
+        process(&sample, 1);
+    }
+
+
+    void MlxSlidingDFT::process(const double *in, size_t n)
+    {
+        const size_t N = _length;
+        const size_t period = MLX_SDFT_RESYNC_WINDOWS * N;
+
+        size_t pos = 0;
+
+        while (pos < n)
+        {
+            // Blocks end at the Resync Point, so the Sums are exact there
+            const size_t len = std::min({ MLX_SDFT_BLOCK, n - pos, period - _samples });
+
+            // x(m) - x(m - N), History advanced once for all Bins
+            size_t h = _pos;
+            for (size_t j = 0; j < len; j++)
+            {
+                _diff[j] = in[pos + j] - _history[h];
+                _history[h] = in[pos + j];
+                if (++h == N) h = 0;
+            }
+
+            for (size_t b = 0; b < _bins.size(); b++)
+            {
+                const double *tr = &_tr[b * MLX_SDFT_BLOCK];
+                const double *ti = &_ti[b * MLX_SDFT_BLOCK];
+                double re, im;
+
+#ifdef MLX_X86_DISPATCH
+                if (_avx2)
+                {
+                    _mlx_sdft_block_avx2(_diff.data(), len, tr, ti, re, im);
+                }
+                else
+#endif
+                {
+                    _mlx_sdft_block(_diff.data(), len, tr, ti, re, im);
+                }
+
+                // Block Sum times the Twiddle of its first Sample
+                const size_t idx = _idx[b];
+                _sr[b] += (re * _w[2 * idx]) - (im * _w[(2 * idx) + 1]);
+                _si[b] += (re * _w[(2 * idx) + 1]) + (im * _w[2 * idx]);
+
+                _idx[b] = (idx + ((_bins[b] * len) % N)) % N;
+            }
+
+            _pos = h;
+            _samples += len;
+            pos += len;
+
+            if (_samples == period)
+            {
+                _resync();
+                _samples = 0;
+            }
+        }
+    }
+
+
+    void MlxSlidingDFT::value(size_t idx, double &re, double &im) const
+    {
+        // Sum runs on absolute Time, rotate to the Window Start: * exp(2 pi i k pos / N)
+        const size_t N = _length;
+        const size_t r = (_bins[idx] * _pos) % N;
+
+        const double cr = _w[2 * r];
+        const double ci = -_w[(2 * r) + 1];
+
+        re = (_sr[idx] * cr) - (_si[idx] * ci);
+        im = (_sr[idx] * ci) + (_si[idx] * cr);
+    }
+
+
+    double MlxSlidingDFT::amplitude(size_t idx) const
+    {
+        const size_t k = _bins.at(idx);
+        const double mag = sqrt((_sr[idx] * _sr[idx]) + (_si[idx] * _si[idx]));
+
+        // DC and Nyquist are not mirrored
+        const bool single = (k == 0) || ((2 * k) == _length);
+        return (single ? 1.0 : 2.0) * mag / _length;
+    }
+
+
+    double MlxSlidingDFT::phase(size_t idx) const
+    {
+        double re, im;
+        value(idx, re, im);
+
+        return atan2(im, re);
+    }
+
+
+    /* Exact Sums from the History: ring Index j holds x(m) with m mod N = j */
+    void MlxSlidingDFT::_resync()
+    {
+        const size_t N = _length;
+
+        for (size_t b = 0; b < _bins.size(); b++)
+        {
+            const size_t k = _bins[b];
+            double sr = 0.0;
+            double si = 0.0;
+            size_t idx = 0;
+
+            for (size_t j = 0; j < N; j++)
+            {
+                sr += _history[j] * _w[2 * idx];
+                si += _history[j] * _w[(2 * idx) + 1];
+
+                idx += k;
+                if (idx >= N) idx -= N;
+            }
+
+            _sr[b] = sr;
+            _si[b] = si;
+        }
+    }
+
+
+}   /* namespace mlx */
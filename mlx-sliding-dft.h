@@ -0,0 +1,148 @@
+/**
+ * @file    mlx-sliding-dft.h
+ * @brief   Sliding DFT Tracker for a small Set of Bins
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+
+namespace mlx
+{
+
+    /* Running Sums are recomputed from the History every this many Windows */
+    static const size_t MLX_SDFT_RESYNC_WINDOWS = 64;
+
+    /* Samples processed per Block in process(), also Length of the per-Bin Twiddle Tables */
+    static const size_t MLX_SDFT_BLOCK = 256;
+
+
+    /**
+     * @brief   DFT Bins of the last N Samples, updated with O(1) Work per Sample and Bin
+     *
+     *  Modulated sliding DFT: every Bin k keeps the running Sum of (x(m) - x(m - N))
+     *  exp(-2 pi i k m / N), with Twiddles taken exactly from Tables (Index k * m mod N).
+     *  There is no Recursion Pole on the unit Circle, so Twiddle Rounding can not build
+     *  up; the remaining Rounding of the running Sum is removed by recomputing it from
+     *  the History every MLX_SDFT_RESYNC_WINDOWS Windows (amortized O(1)).
+     *
+     *  Input is consumed in Blocks: per Bin one real-by-complex Dot Product with a
+     *  precomputed Twiddle Table and one Rotation per Block, so K Bins cost about K
+     *  Multiply-Add Pairs per Sample where an FFT of every Frame costs O(log2(N)).
+     */
+    class MlxSlidingDFT
+    {
+    public:
+
+        /**
+         * @brief   Track DFT Bins
+         *
+         * @param N     Window Length
+         * @param bins  Bin Indices (0 ... N/2)
+         */
+        MlxSlidingDFT(size_t N, const std::vector<size_t> &bins);
+
+        /**
+         * @brief   Track Frequencies, each rounded to the nearest Bin
+         *
+         * @param N             Window Length
+         * @param fs            Sample Frequency
+         * @param frequencies   Frequencies in Hz
+         */
+        MlxSlidingDFT(size_t N, double fs, const std::vector<double> &frequencies);
+
+        ~MlxSlidingDFT();
+
+
+        size_t length() const;
+        size_t size() const;
+        size_t bin(size_t idx) const;
+
+
+        /**
+         * @brief   Feed one Sample
+         */
+        void process(double sample);
+
+        /**
+         * @brief   Feed a Block of Samples
+         *
+         * @param in    Samples
+         * @param n     Number of Samples
+         */
+        void process(const double *in, size_t n);
+
+
+        /**
+         * @brief   DFT Value of the current Window (Window Start = Time 0)
+         *
+         * @param idx   tracked Bin
+         * @param re    Real Part
+         * @param im    Imaginary Part
+         */
+        void value(size_t idx, double &re, double &im) const;
+
+        /**
+         * @brief   single-sided Amplitude: a Sine of Amplitude A on the Bin reads A
+         */
+        double amplitude(size_t idx) const;
+
+        /**
+         * @brief   Phase in rad relative to the Window Start (cosine Reference)
+         */
+        double phase(size_t idx) const;
+
+
+        /**
+         * @brief   Clear History and Sums
+         *
+         */
+        void reset();
+
+
+    protected:
+
+        void _resync();
+
+        const size_t _length;
+        std::vector<size_t> _bins;
+
+        // exp(-2 pi i m / N), interleaved re / im
+        std::vector<double> _w;
+
+        // exp(-2 pi i k j / N) for j < MLX_SDFT_BLOCK - [bin * MLX_SDFT_BLOCK + j]
+        std::vector<double> _tr;
+        std::vector<double> _ti;
+
+        // History (x(m) at m mod N) and Write Position
+        std::vector<double> _history;
+        size_t _pos;
+        size_t _samples;
+
+        // Running Sums and Twiddle Index of the next Block (k * m mod N) per Bin
+        std::vector<double> _sr;
+        std::vector<double> _si;
+        std::vector<size_t> _idx;
+
+        std::vector<double> _diff;
+
+        bool _avx2;
+
+
+    };  /* MlxSlidingDFT */
+
+
+}   /* namespace mlx */
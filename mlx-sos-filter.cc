@@ -1,11 +1,25 @@
 
 
 #include "mlx-sos-filter.h"
+#include "mlx-static-sos-filter.h"
+
+#include <algorithm>
+#include <mutex>
 
 
 namespace mlx
 {
 
+    namespace
+    {
+        /* Stages per Group: ceil(S / MLX_SOS_FILTER_MAX_GROUP) Groups of (nearly) equal Size */
+        size_t _mlx_sos_group_size(size_t stages)
+        {
+            const size_t groups = (stages + MLX_SOS_FILTER_MAX_GROUP - 1) / MLX_SOS_FILTER_MAX_GROUP;
+            return (stages + groups - 1) / groups;
+        }
+    }
+
 
     MlxSOSFilterStage::MlxSOSFilterStage(double b0, double b1, double b2, double a1, double a2)
     : _b0(b0), _b1(b1), _b2(b2), _a0(1), _a1(a1), _a2(a2)
@@ -38,6 +52,20 @@ namespace mlx
     }
 
 
+    void MlxSOSFilterStage::getState(double &t0, double &t1) const
+    {
+        t0 = _t0;
+        t1 = _t1;
+    }
+
+
+    void MlxSOSFilterStage::setState(double t0, double t1)
+    {
+        _t0 = t0;
+        _t1 = t1;
+    }
+
+
 
 /// Start - MlxSOSFilter
 
@@ -64,6 +92,100 @@ namespace mlx
     }
 
 
+    void MlxSOSFilter::filter(const double *in, double *out, size_t n)
+    {
+        if (_filterSet.empty())
+        {
+            if (in != out) std::copy(in, in + n, out);
+            return;
+        }
+
+        const size_t G = _mlx_sos_group_size(_filterSet.size());
+        const double *src = in;
+
+        for (size_t first = 0; first < _filterSet.size(); first += G)
+        {
+            const size_t last = std::min(first + G, _filterSet.size());
+            _filterGroup(first, last, src, out, n);
+            src = out;
+        }
+    }
+
+
+    void MlxSOSFilter::filter(double *data, size_t n)
+    {
+        filter(data, data, n);
+    }
+
+
+    void MlxSOSFilter::filter(const float *in, float *out, size_t n)
+    {
+        const size_t S = _filterSet.size();
+
+        if (S <= MLX_SOS_FILTER_MAX_GROUP)
+        {
+            if (S > 0) _filterGroup(0, S, in, out, n);
+            else if (in != out) std::copy(in, in + n, out);
+            return;
+        }
+
+        // Chunks pass between the Groups in double, only the last Group rounds to float
+        const size_t G = _mlx_sos_group_size(S);
+        double buf[MLX_SOS_FILTER_CHUNK];
+
+        for (size_t pos = 0; pos < n; pos += MLX_SOS_FILTER_CHUNK)
+        {
+            const size_t len = std::min(MLX_SOS_FILTER_CHUNK, n - pos);
+
+            _filterGroup(0, G, in + pos, buf, len);
+
+            for (size_t first = G; first < S; first += G)
+            {
+                const size_t last = std::min(first + G, S);
+
+                if (last < S)
+                {
+                    _filterGroup(first, last, buf, buf, len);
+                }
+                else
+                {
+                    _filterGroup(first, last, buf, out + pos, len);
+                }
+            }
+        }
+    }
+
+
+    void MlxSOSFilter::filter(float *data, size_t n)
+    {
+        filter(data, data, n);
+    }
+
+
+    void MlxSOSFilter::reset()
+    {
+        for (MlxSOSFilterStage& fil : _filterSet)
+        {
+            fil.reset();
+        }
+    }
+
+
+    size_t MlxSOSFilter::stages() const
+    {
+        return _filterSet.size();
+    }
+
+
+    bool MlxSOSFilter::setStageState(size_t idx, double t0, double t1)
+    {
+        if (idx >= _filterSet.size()) return false;
+
+        _filterSet[idx].setState(t0, t1);
+        return true;
+    }
+
+
     MlxSOSFilter* MlxSOSFilter::addStage(double b0, double b1, double b2, double a1, double a2)
     {
         _filterSet.push_back(
@@ -74,6 +196,57 @@ namespace mlx
     }
 
 
+    const std::vector<MlxSOSFilterStage>& MlxSOSFilter::getStages() const
+    {
+        return _filterSet;
+    }
+
+
+    template <typename In, typename Out>
+    void MlxSOSFilter::_filterGroup(size_t first, size_t last, const In *in, Out *out, size_t n)
+    {
+        const size_t S = last - first;
+
+        double b0[MLX_SOS_FILTER_MAX_GROUP], b1[MLX_SOS_FILTER_MAX_GROUP], b2[MLX_SOS_FILTER_MAX_GROUP];
+        double a1[MLX_SOS_FILTER_MAX_GROUP], a2[MLX_SOS_FILTER_MAX_GROUP];
+        double t0[MLX_SOS_FILTER_MAX_GROUP], t1[MLX_SOS_FILTER_MAX_GROUP];
+
+        for (size_t s = 0; s < S; s++)
+        {
+            const MlxSOSFilterStage& fil = _filterSet[first + s];
+
+            b0[s] = fil.b0();
+            b1[s] = fil.b1();
+            b2[s] = fil.b2();
+            a1[s] = fil.a1();
+            a2[s] = fil.a2();
+            fil.getState(t0[s], t1[s]);
+        }
+
+        for (size_t k = 0; k < n; k++)
+        {
+            double x = double(in[k]);
+
+            for (size_t s = 0; s < S; s++)
+            {
+                const double y = t0[s] + (b0[s] * x);
+
+                t0[s] = t1[s] + (b1[s] * x) - (a1[s] * y);
+                t1[s] = (b2[s] * x) - (a2[s] * y);
+
+                x = y;
+            }
+
+            out[k] = Out(x);
+        }
+
+        for (size_t s = 0; s < S; s++)
+        {
+            _filterSet[first + s].setState(t0[s], t1[s]);
+        }
+    }
+
+
 /// END - MlxSOSFilter
 /// Start - MlxSOSFilterFactory
 
@@ -88,6 +261,16 @@ namespace mlx
     }
 
 
+    template <size_t N>
+    static void _addStages(std::shared_ptr<MlxSOSFilter> filter, const std::array<MlxSOSCoefficients, N> &coeffs)
+    {
+        for (const MlxSOSCoefficients& c : coeffs)
+        {
+            filter->addStage(c.b0, c.b1, c.b2, c.a1, c.a2);
+        }
+    }
+
+
     std::shared_ptr<MlxSOSFilter> MlxSOSFilterFactory::getFilter_Butterworth(fc_fs_ratio fcsr)
     {
         std::shared_ptr<MlxSOSFilter> filter = std::make_shared<MlxSOSFilter>();
@@ -97,25 +280,7 @@ namespace mlx
         {
 
         case ratio_10p:
-            filter->addStage(
-                5.128132645416496e-13, 1.0256265290832993e-12, 5.128132645416496e-13, -1.6358161595128016, 0.6694470835583565
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.6544507637455192, 0.6884647986656827
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.6916794338709686, 0.7264588571081657
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.7472829046575309, 0.7832054857562134
-            )
-            ->addStage(
-                1.0, 2.0, 1.0,  -1.8205716411956112, 0.8580009734763099
-            )
-            ->addStage(
-                1.0, 2.0, 1.0,  -1.9099233994325144, 0.9491897243221484
-            );
-
+            _addStages(filter, MLX_SOS_BUTTERWORTH_10P_COEFFS);
             break;
         
         default:
@@ -135,54 +300,11 @@ namespace mlx
         {
         
         case ratio_05p:
-
-            filter->addStage(
-                1.3164591487194416e-12, 2.632918297438883e-12, 1.3164591487194416e-12, -1.4967220429743726, 0.5604402298082104
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.5031754338000556, 0.5684943341991748
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.5165678617134124, 0.5852950144369798
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.5380229114586013, 0.6124571676498912
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.5697380725036985, 0.6531803028874344
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.6162389834768125, 0.7141683430722784
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.6894048345910613, 0.8133772402519509
-            );
-
+            _addStages(filter, MLX_SOS_BESSEL_05P_COEFFS);
             break;
 
         case ratio_10p:
-            filter->addStage(
-                6.346130800455662e-09, 1.2692261600911324e-08, 6.346130800455662e-09, -1.0875854483710024, 0.2967242585300517
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.0931310231047813, 0.3080182221218568
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.1045919801935986, 0.3317747936513281
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.1228090927121035, 0.37074660344375854
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.1493766733713506, 0.43047508936230816
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.1874264993018948, 0.5228171438494588
-            )
-            ->addStage(
-                1.0, 2.0, 1.0, -1.244638184591471, 0.6803072537872193
-            );
-
+            _addStages(filter, MLX_SOS_BESSEL_10P_COEFFS);
             break;
         
         default:
@@ -194,6 +316,82 @@ namespace mlx
     }
 
 
+    std::map<MlxIIRDesignSpec, MlxSOSFilterFactory::_design_t> MlxSOSFilterFactory::_designCache = {};
+    std::shared_mutex MlxSOSFilterFactory::_designMutex;
+
+
+    std::shared_ptr<MlxSOSFilter> MlxSOSFilterFactory::getFilter(const MlxIIRDesignSpec &spec)
+    {
+        std::shared_ptr<MlxSOSFilter> filter = std::make_shared<MlxSOSFilter>();
+
+        _design_t design = _getDesign(spec);
+
+        if (design == nullptr)
+        {
+            return filter;
+        }
+
+        for (const MlxSOSCoefficients& c : *design)
+        {
+            filter->addStage(c.b0, c.b1, c.b2, c.a1, c.a2);
+        }
+
+        return filter;
+    }
+
+
+    std::shared_ptr<MlxSOSFilter> MlxSOSFilterFactory::getFilter(IIRFamily_t family, IIRBand_t band, size_t order, double fs, double fc1, double fc2, double rp, double rs)
+    {
+        return getFilter(MlxIIRDesignSpec { family, band, order, fs, fc1, fc2, rp, rs });
+    }
+
+
+    size_t MlxSOSFilterFactory::designCacheSize()
+    {
+        std::shared_lock<std::shared_mutex> lock(_designMutex);
+        return _designCache.size();
+    }
+
+
+    void MlxSOSFilterFactory::clearDesignCache()
+    {
+        std::unique_lock<std::shared_mutex> lock(_designMutex);
+        _designCache.clear();
+    }
+
+
+    MlxSOSFilterFactory::_design_t MlxSOSFilterFactory::_getDesign(const MlxIIRDesignSpec &spec)
+    {
+        // Parameters not used by the Design must not split the Cache
+        MlxIIRDesignSpec key = spec;
+
+        if ((key.band == MLX_IIR_LOWPASS) || (key.band == MLX_IIR_HIGHPASS)) key.fc2 = 0.0;
+        if ((key.family != MLX_IIR_CHEBYSHEV1) && (key.family != MLX_IIR_ELLIPTIC)) key.rp = 0.0;
+        if ((key.family != MLX_IIR_CHEBYSHEV2) && (key.family != MLX_IIR_ELLIPTIC)) key.rs = 0.0;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(_designMutex);
+
+            if (auto search = _designCache.find(key); search != _designCache.end())
+            {
+                return search->second;
+            }
+        }
+
+        // Design outside the Lock, concurrent Misses for the same Key yield identical Results
+        std::shared_ptr<std::vector<MlxSOSCoefficients>> sos = std::make_shared<std::vector<MlxSOSCoefficients>>();
+
+        if (!designIIR(key, *sos))
+        {
+            return nullptr;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(_designMutex);
+
+        auto res = _designCache.insert(std::make_pair(key, sos));
+        return res.first->second;
+    }
+
 
 /// END - MlxSOSFilterFactory
 
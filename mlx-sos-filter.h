@@ -5,11 +5,22 @@
 
 #include <vector>
 #include <memory>
+#include <map>
+#include <shared_mutex>
+
+#include "mlx-iir-design.h"
 
 
 namespace mlx
 {
 
+    /* Max. Number of Stages whose State is held locally during Block Processing */
+    static const size_t MLX_SOS_FILTER_MAX_GROUP = 16;
+
+    /* Samples passed between Stage Groups in double when filtering float Blocks */
+    static const size_t MLX_SOS_FILTER_CHUNK = 256;
+
+
 /**
  * @brief 
  * 
@@ -47,6 +58,30 @@ public:
     void reset();
 
 
+    double b0() const { return _b0; }
+    double b1() const { return _b1; }
+    double b2() const { return _b2; }
+    double a1() const { return _a1; }
+    double a2() const { return _a2; }
+
+
+    /**
+     * @brief   Read internal Mem-Elements
+     * 
+     * @param t0    First Memory Element
+     * @param t1    Second Memory Element
+     */
+    void getState(double &t0, double &t1) const;
+
+    /**
+     * @brief   Set internal Mem-Elements (e.g. Initial Conditions)
+     * 
+     * @param t0    First Memory Element
+     * @param t1    Second Memory Element
+     */
+    void setState(double t0, double t1);
+
+
 protected:
 private:
 
@@ -76,11 +111,78 @@ public:
 
     double filter(double sample);
 
+    /**
+     * @brief   Filter a Block of Samples, Coefficients and State are held locally for the whole Block
+     *
+     *  Stages run in ceil(S / MLX_SOS_FILTER_MAX_GROUP) Groups of equal Size, each Sample
+     *  passes all Stages of a Group before the next one is taken. Stage-outer Order (one
+     *  Stage over the whole Block) was not used: it turns every Stage into one long
+     *  Dependency Chain, while sample-outer lets the CPU overlap the Recurrences of the
+     *  Stages in a Group.
+     * 
+     * @param in    Input Samples
+     * @param out   Output Samples (may be equal to in)
+     * @param n     Number of Samples
+     */
+    void filter(const double *in, double *out, size_t n);
+
+    /**
+     * @brief   Filter a Block of Samples in-place
+     * 
+     * @param data  Samples
+     * @param n     Number of Samples
+     */
+    void filter(double *data, size_t n);
+
+    /**
+     * @brief   Filter a Block of float Samples, Coefficients and State stay double
+     *
+     *  Intermediate Values stay double through all Stages, also between Stage Groups,
+     *  so the Output is rounded to float once (~3e-8 relative RMS to the double Path).
+     *  Buffers take half the Memory. For float State as well see MlxStaticSOSFilter.
+     * 
+     * @param in    Input Samples
+     * @param out   Output Samples (may be equal to in)
+     * @param n     Number of Samples
+     */
+    void filter(const float *in, float *out, size_t n);
+
+    /**
+     * @brief   Filter a Block of float Samples in-place
+     * 
+     * @param data  Samples
+     * @param n     Number of Samples
+     */
+    void filter(float *data, size_t n);
+
+    /**
+     * @brief   Reset the Mem-Elements of all Stages
+     * 
+     */
+    void reset();
+
+    size_t stages() const;
+
+    /**
+     * @brief   Set Mem-Elements of one Stage (e.g. Initial Conditions)
+     * 
+     * @param idx   Stage Index
+     * @param t0    First Memory Element
+     * @param t1    Second Memory Element
+     * @return      false if Stage does not exist
+     */
+    bool setStageState(size_t idx, double t0, double t1);
+
     MlxSOSFilter* addStage(double b0, double b1, double b2, double a1, double a2);
 
+    const std::vector<MlxSOSFilterStage>& getStages() const;
+
 
 protected:
 
+    template <typename In, typename Out>
+    void _filterGroup(size_t first, size_t last, const In *in, Out *out, size_t n);
+
     std::vector<MlxSOSFilterStage> _filterSet;
 
 
@@ -113,8 +215,44 @@ public:
      */
     static std::shared_ptr<MlxSOSFilter> getFilter_Bessel(fc_fs_ratio fcsr);
 
+
+    /**
+     * @brief   Returns Filter designed at Runtime, Coefficients are cached per Design
+     * 
+     * @param   spec    Design Parameters
+     * @return  std::shared_ptr<MlxSOSFilter> (without Stages if the Design is invalid)
+     */
+    static std::shared_ptr<MlxSOSFilter> getFilter(const MlxIIRDesignSpec &spec);
+
+    /**
+     * @brief   Returns Filter designed at Runtime, Coefficients are cached per Design
+     * 
+     * @param   family  Butterworth, Bessel, Chebyshev I/II, Elliptic
+     * @param   band    Low-, High-, Band-Pass or Band-Stop
+     * @param   order   Filter Order (Band Filters get twice the Poles)
+     * @param   fs      Sample Frequency in Hz
+     * @param   fc1     (Lower) Cutoff Frequency in Hz
+     * @param   fc2     Upper Cutoff Frequency in Hz (Band Filters only)
+     * @param   rp      Passband Ripple in dB (Chebyshev I, Elliptic)
+     * @param   rs      Stopband Attenuation in dB (Chebyshev II, Elliptic)
+     * @return  std::shared_ptr<MlxSOSFilter> (without Stages if the Design is invalid)
+     */
+    static std::shared_ptr<MlxSOSFilter> getFilter(IIRFamily_t family, IIRBand_t band, size_t order, double fs, double fc1, double fc2 = 0.0, double rp = 1.0, double rs = 40.0);
+
+
+    static size_t designCacheSize();
+    static void clearDesignCache();
+
 protected:
 
+    typedef std::shared_ptr<const std::vector<MlxSOSCoefficients>> _design_t;
+
+    static _design_t _getDesign(const MlxIIRDesignSpec &spec);
+
+    /* Designed Coefficients, shared by all Filters with the same Spec */
+    static std::map<MlxIIRDesignSpec, _design_t> _designCache;
+    static std::shared_mutex _designMutex;
+
 };  /* MlxSOSFilterFactory */
 
 
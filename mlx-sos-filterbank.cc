@@ -0,0 +1,320 @@
+/**
+ * @file    mlx-sos-filterbank.cc
+ * @brief   Multi-Channel SOS Filter Bank (SoA State, SIMD Lanes)
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-sos-filterbank.h"
+#include "mlx-cpu-features.h"
+
+#include <algorithm>
+
+#ifdef MLX_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+
+namespace mlx
+{
+
+    namespace
+    {
+        /* One Group of up to MLX_SOS_FILTER_MAX_GROUP Stages, State at [stage * channels] */
+        template <typename T>
+        struct _mlx_sos_group_t
+        {
+            const T *b0;
+            const T *b1;
+            const T *b2;
+            const T *a1;
+            const T *a2;
+
+            T *t0;
+            T *t1;
+
+            size_t stages;
+            size_t channels;
+        };
+
+
+        /* Lanes of the scalar Fallback: one Channel per Call */
+        template <typename T>
+        struct _mlx_sos_scalar_t
+        {
+            typedef T vec_t;
+            typedef T uvec_t;
+            static const size_t lanes = 1;
+        };
+
+
+#ifdef MLX_X86_DISPATCH
+        /* Vector Type, unaligned Load / Store Type and Lanes per Instruction Set */
+        template <typename T> struct _mlx_sos_avx2_t;
+        template <typename T> struct _mlx_sos_avx512_t;
+
+        template <>
+        struct _mlx_sos_avx2_t<double>
+        {
+            typedef __m256d vec_t;
+            typedef __m256d_u uvec_t;
+            static const size_t lanes = 4;
+        };
+
+        template <>
+        struct _mlx_sos_avx2_t<float>
+        {
+            typedef __m256 vec_t;
+            typedef __m256_u uvec_t;
+            static const size_t lanes = 8;
+        };
+
+        template <>
+        struct _mlx_sos_avx512_t<double>
+        {
+            typedef __m512d vec_t;
+            typedef __m512d_u uvec_t;
+            static const size_t lanes = 8;
+        };
+
+        template <>
+        struct _mlx_sos_avx512_t<float>
+        {
+            typedef __m512 vec_t;
+            typedef __m512_u uvec_t;
+            static const size_t lanes = 16;
+        };
+#endif
+
+
+        /*
+         *  Channels c0 ... c0 + L::lanes - 1 through one Stage Group. Written with the
+         *  Vector Operators of GCC / Clang, so the same Body serves the scalar Fallback
+         *  and every Instruction Set the Wrapper below is compiled for.
+         */
+        template <typename L, typename T>
+        inline __attribute__((always_inline))
+        void _mlx_sos_bank_lanes(const _mlx_sos_group_t<T> &g, size_t c0, const T *in, T *out, size_t frames)
+        {
+            typedef typename L::vec_t vec_t;
+            typedef typename L::uvec_t uvec_t;
+
+            const size_t C = g.channels;
+            const size_t S = g.stages;
+            const vec_t zero = {};
+
+            vec_t b0[MLX_SOS_FILTER_MAX_GROUP], b1[MLX_SOS_FILTER_MAX_GROUP], b2[MLX_SOS_FILTER_MAX_GROUP];
+            vec_t a1[MLX_SOS_FILTER_MAX_GROUP], a2[MLX_SOS_FILTER_MAX_GROUP];
+            vec_t t0[MLX_SOS_FILTER_MAX_GROUP], t1[MLX_SOS_FILTER_MAX_GROUP];
+
+            for (size_t s = 0; s < S; s++)
+            {
+                b0[s] = zero + g.b0[s];
+                b1[s] = zero + g.b1[s];
+                b2[s] = zero + g.b2[s];
+                a1[s] = zero + g.a1[s];
+                a2[s] = zero + g.a2[s];
+
+                t0[s] = *(const uvec_t*)(g.t0 + (s * C) + c0);
+                t1[s] = *(const uvec_t*)(g.t1 + (s * C) + c0);
+            }
+
+            for (size_t k = 0; k < frames; k++)
+            {
+                vec_t x = *(const uvec_t*)(in + (k * C) + c0);
+
+                for (size_t s = 0; s < S; s++)
+                {
+                    const vec_t y = t0[s] + (b0[s] * x);
+
+                    t0[s] = t1[s] + (b1[s] * x) - (a1[s] * y);
+                    t1[s] = (b2[s] * x) - (a2[s] * y);
+
+                    x = y;
+                }
+
+                *(uvec_t*)(out + (k * C) + c0) = x;
+            }
+
+            for (size_t s = 0; s < S; s++)
+            {
+                *(uvec_t*)(g.t0 + (s * C) + c0) = t0[s];
+                *(uvec_t*)(g.t1 + (s * C) + c0) = t1[s];
+            }
+        }
+
+
+        template <typename T>
+        void _mlx_sos_bank_scalar(const _mlx_sos_group_t<T> &g, size_t c0, const T *in, T *out, size_t frames)
+        {
+            _mlx_sos_bank_lanes<_mlx_sos_scalar_t<T>>(g, c0, in, out, frames);
+        }
+
+
+#ifdef MLX_X86_DISPATCH
+        template <typename T>
+        __attribute__((target("avx2,fma")))
+        void _mlx_sos_bank_avx2(const _mlx_sos_group_t<T> &g, size_t c0, const T *in, T *out, size_t frames)
+        {
+            _mlx_sos_bank_lanes<_mlx_sos_avx2_t<T>>(g, c0, in, out, frames);
+        }
+
+
+        template <typename T>
+        __attribute__((target("avx512f")))
+        void _mlx_sos_bank_avx512(const _mlx_sos_group_t<T> &g, size_t c0, const T *in, T *out, size_t frames)
+        {
+            _mlx_sos_bank_lanes<_mlx_sos_avx512_t<T>>(g, c0, in, out, frames);
+        }
+#endif
+
+    }   /* anonymous namespace */
+
+
+
+    template <typename T>
+    MlxBasicSOSFilterBank<T>::MlxBasicSOSFilterBank(size_t channels, const MlxSOSFilter &prototype)
+    : _channels(channels)
+    , _stages(prototype.stages())
+    , _avx2(mlxCpuHasAvx2Fma())
+    , _avx512(mlxCpuHasAvx512f())
+    {
+        for (const MlxSOSFilterStage& fil : prototype.getStages())
+        {
+            _b0.push_back(T(fil.b0()));
+            _b1.push_back(T(fil.b1()));
+            _b2.push_back(T(fil.b2()));
+            _a1.push_back(T(fil.a1()));
+            _a2.push_back(T(fil.a2()));
+        }
+
+        _t0.resize(_stages * _channels);
+        _t1.resize(_stages * _channels);
+        _scratch.resize(MLX_SOS_FILTERBANK_CHUNK * _channels);
+
+        reset();
+    }
+
+
+    template <typename T>
+    MlxBasicSOSFilterBank<T>::~MlxBasicSOSFilterBank()
+    {
+    }
+
+
+    template <typename T>
+    size_t MlxBasicSOSFilterBank<T>::channels() const
+    {
+        return _channels;
+    }
+
+
+    template <typename T>
+    size_t MlxBasicSOSFilterBank<T>::stages() const
+    {
+        return _stages;
+    }
+
+
+    template <typename T>
+    void MlxBasicSOSFilterBank<T>::reset()
+    {
+        std::fill(_t0.begin(), _t0.end(), T(0));
+        std::fill(_t1.begin(), _t1.end(), T(0));
+    }
+
+
+    template <typename T>
+    void MlxBasicSOSFilterBank<T>::filterInterleaved(const T *in, T *out, size_t frames)
+    {
+        _process(in, out, frames);
+    }
+
+
+    template <typename T>
+    void MlxBasicSOSFilterBank<T>::filterPlanar(const T *in, T *out, size_t samples)
+    {
+        const size_t C = _channels;
+
+        for (size_t pos = 0; pos < samples; pos += MLX_SOS_FILTERBANK_CHUNK)
+        {
+            const size_t len = std::min(MLX_SOS_FILTERBANK_CHUNK, samples - pos);
+
+            for (size_t ch = 0; ch < C; ch++)
+            {
+                const T *src = in + (ch * samples) + pos;
+                for (size_t k = 0; k < len; k++) _scratch[(k * C) + ch] = src[k];
+            }
+
+            _process(_scratch.data(), _scratch.data(), len);
+
+            for (size_t ch = 0; ch < C; ch++)
+            {
+                T *dst = out + (ch * samples) + pos;
+                for (size_t k = 0; k < len; k++) dst[k] = _scratch[(k * C) + ch];
+            }
+        }
+    }
+
+
+    template <typename T>
+    void MlxBasicSOSFilterBank<T>::_process(const T *in, T *out, size_t frames)
+    {
+        if ((_stages == 0) || (_channels == 0))
+        {
+            if (in != out) std::copy(in, in + (frames * _channels), out);
+            return;
+        }
+
+        // All Channel Groups work on one Chunk of Frames while it is still in Cache
+        for (size_t pos = 0; pos < frames; pos += MLX_SOS_FILTERBANK_CHUNK)
+        {
+            const size_t len = std::min(MLX_SOS_FILTERBANK_CHUNK, frames - pos);
+            const T *src = in + (pos * _channels);
+            T *dst = out + (pos * _channels);
+
+            for (size_t first = 0; first < _stages; first += MLX_SOS_FILTER_MAX_GROUP)
+            {
+                const _mlx_sos_group_t<T> g = {
+                    &_b0[first], &_b1[first], &_b2[first], &_a1[first], &_a2[first],
+                    &_t0[first * _channels], &_t1[first * _channels],
+                    std::min(MLX_SOS_FILTER_MAX_GROUP, _stages - first), _channels
+                };
+
+                size_t c = 0;
+
+#ifdef MLX_X86_DISPATCH
+                if (_avx512)
+                {
+                    const size_t L = _mlx_sos_avx512_t<T>::lanes;
+                    for (; (c + L) <= _channels; c += L) _mlx_sos_bank_avx512(g, c, src, dst, len);
+                }
+
+                if (_avx2)
+                {
+                    const size_t L = _mlx_sos_avx2_t<T>::lanes;
+                    for (; (c + L) <= _channels; c += L) _mlx_sos_bank_avx2(g, c, src, dst, len);
+                }
+#endif
+
+                for (; c < _channels; c++) _mlx_sos_bank_scalar(g, c, src, dst, len);
+
+                src = dst;
+            }
+        }
+    }
+
+
+    template class MlxBasicSOSFilterBank<double>;
+    template class MlxBasicSOSFilterBank<float>;
+
+
+}   /* namespace mlx */
@@ -0,0 +1,216 @@
+/**
+ * @file    mlx-static-sos-filter.h
+ * @brief   SOS Cascade with Stage Count fixed at Compile Time
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <array>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+
+#include "mlx-iir-design.h"
+
+
+namespace mlx
+{
+
+    /**
+     * @brief   Fixed-Order SOS Cascade (Transposed Direct Form II)
+     *
+     *  Same Interface as MlxSOSFilter, but the Stage Loop is unrolled at Compile Time
+     *  so Coefficients and Mem-Elements can live in Registers.
+     *
+     * @tparam NStages  Number of Second Order Sections
+     * @tparam T        Sample / State Type
+     */
+    template <size_t NStages, typename T = double>
+    class MlxStaticSOSFilter
+    {
+    public:
+
+        typedef std::array<MlxSOSCoefficients, NStages> coefficients_t;
+
+
+        constexpr MlxStaticSOSFilter(const coefficients_t &coeffs)
+        : _coeffs(_convert(coeffs, std::make_index_sequence<NStages>{}))
+        , _t0{}
+        , _t1{}
+        {
+        }
+
+
+        static constexpr size_t stages()
+        {
+            return NStages;
+        }
+
+
+        /**
+         * @brief   Filter one Sample
+         *
+         * @param sample    Sample
+         * @return T
+         */
+        T filter(T sample)
+        {
+            return _cascade(sample, _t0, _t1, std::make_index_sequence<NStages>{});
+        }
+
+
+        /**
+         * @brief   Filter a Block of Samples, State is held locally for the whole Block
+         *
+         * @param in    Input Samples
+         * @param out   Output Samples (may be equal to in)
+         * @param n     Number of Samples
+         */
+        void filter(const T *in, T *out, size_t n)
+        {
+            std::array<T, NStages> t0 = _t0;
+            std::array<T, NStages> t1 = _t1;
+
+            for (size_t k = 0; k < n; k++)
+            {
+                out[k] = _cascade(in[k], t0, t1, std::make_index_sequence<NStages>{});
+            }
+
+            _t0 = t0;
+            _t1 = t1;
+        }
+
+
+        /**
+         * @brief   Filter a Block of Samples in-place
+         *
+         * @param data  Samples
+         * @param n     Number of Samples
+         */
+        void filter(T *data, size_t n)
+        {
+            filter(data, data, n);
+        }
+
+
+        /**
+         * @brief   Reset the Mem-Elements of all Stages
+         *
+         */
+        void reset()
+        {
+            _t0.fill(T(0));
+            _t1.fill(T(0));
+        }
+
+
+    private:
+
+        struct _section_t
+        {
+            T b0;
+            T b1;
+            T b2;
+            T a1;
+            T a2;
+        };
+
+
+        template <size_t... S>
+        static constexpr std::array<_section_t, NStages> _convert(const coefficients_t &c, std::index_sequence<S...>)
+        {
+            return {{ _section_t { T(c[S].b0), T(c[S].b1), T(c[S].b2), T(c[S].a1), T(c[S].a2) }... }};
+        }
+
+
+        template <size_t S>
+        T _stage(T x, std::array<T, NStages> &t0, std::array<T, NStages> &t1) const
+        {
+            const _section_t &c = std::get<S>(_coeffs);
+            const T y = t0[S] + (c.b0 * x);
+
+            t0[S] = t1[S] + (c.b1 * x) - (c.a1 * y);
+            t1[S] = (c.b2 * x) - (c.a2 * y);
+
+            return y;
+        }
+
+
+        template <size_t... S>
+        T _cascade(T x, std::array<T, NStages> &t0, std::array<T, NStages> &t1, std::index_sequence<S...>) const
+        {
+            ((x = _stage<S>(x, t0, t1)), ...);
+            return x;
+        }
+
+
+        std::array<_section_t, NStages> _coeffs;
+
+        // Memory Elements
+        std::array<T, NStages> _t0;
+        std::array<T, NStages> _t1;
+
+
+    };  /* MlxStaticSOSFilter */
+
+
+
+/// Start - Presets (see MlxSOSFilterFactory)
+
+
+    /* Butterworth, 12th Order - MlxSOSFilterFactory::ratio_10p */
+    inline constexpr std::array<MlxSOSCoefficients, 6> MLX_SOS_BUTTERWORTH_10P_COEFFS = {{
+        { 5.128132645416496e-13, 1.0256265290832993e-12, 5.128132645416496e-13, -1.6358161595128016, 0.6694470835583565 },
+        { 1.0, 2.0, 1.0, -1.6544507637455192, 0.6884647986656827 },
+        { 1.0, 2.0, 1.0, -1.6916794338709686, 0.7264588571081657 },
+        { 1.0, 2.0, 1.0, -1.7472829046575309, 0.7832054857562134 },
+        { 1.0, 2.0, 1.0, -1.8205716411956112, 0.8580009734763099 },
+        { 1.0, 2.0, 1.0, -1.9099233994325144, 0.9491897243221484 },
+    }};
+
+
+    /* Bessel, 14th Order - MlxSOSFilterFactory::ratio_05p */
+    inline constexpr std::array<MlxSOSCoefficients, 7> MLX_SOS_BESSEL_05P_COEFFS = {{
+        { 1.3164591487194416e-12, 2.632918297438883e-12, 1.3164591487194416e-12, -1.4967220429743726, 0.5604402298082104 },
+        { 1.0, 2.0, 1.0, -1.5031754338000556, 0.5684943341991748 },
+        { 1.0, 2.0, 1.0, -1.5165678617134124, 0.5852950144369798 },
+        { 1.0, 2.0, 1.0, -1.5380229114586013, 0.6124571676498912 },
+        { 1.0, 2.0, 1.0, -1.5697380725036985, 0.6531803028874344 },
+        { 1.0, 2.0, 1.0, -1.6162389834768125, 0.7141683430722784 },
+        { 1.0, 2.0, 1.0, -1.6894048345910613, 0.8133772402519509 },
+    }};
+
+
+    /* Bessel, 14th Order - MlxSOSFilterFactory::ratio_10p */
+    inline constexpr std::array<MlxSOSCoefficients, 7> MLX_SOS_BESSEL_10P_COEFFS = {{
+        { 6.346130800455662e-09, 1.2692261600911324e-08, 6.346130800455662e-09, -1.0875854483710024, 0.2967242585300517 },
+        { 1.0, 2.0, 1.0, -1.0931310231047813, 0.3080182221218568 },
+        { 1.0, 2.0, 1.0, -1.1045919801935986, 0.3317747936513281 },
+        { 1.0, 2.0, 1.0, -1.1228090927121035, 0.37074660344375854 },
+        { 1.0, 2.0, 1.0, -1.1493766733713506, 0.43047508936230816 },
+        { 1.0, 2.0, 1.0, -1.1874264993018948, 0.5228171438494588 },
+        { 1.0, 2.0, 1.0, -1.244638184591471, 0.6803072537872193 },
+    }};
+
+
+    /* Filter Instances with zero State - copy before use */
+    inline constexpr MlxStaticSOSFilter<6> MLX_SOS_BUTTERWORTH_10P { MLX_SOS_BUTTERWORTH_10P_COEFFS };
+    inline constexpr MlxStaticSOSFilter<7> MLX_SOS_BESSEL_05P { MLX_SOS_BESSEL_05P_COEFFS };
+    inline constexpr MlxStaticSOSFilter<7> MLX_SOS_BESSEL_10P { MLX_SOS_BESSEL_10P_COEFFS };
+
+
+/// END - Presets
+
+
+}   /* namespace mlx */
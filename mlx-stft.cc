@@ -0,0 +1,177 @@
+/**
+ * @file    mlx-stft.cc
+ * @brief   Streaming Short-Time Fourier Transform / Spectrogram
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-stft.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+namespace mlx
+{
+
+    MlxSTFT::MlxSTFT(size_t frameLength, size_t hop, WindowType_t window, SpectrumType_t type)
+    : MlxSTFT(windowFunction(window, frameLength), hop, type)
+    {
+    }
+
+
+    MlxSTFT::MlxSTFT(const std::vector<double> &window, size_t hop, SpectrumType_t type)
+    : _length(std::max<size_t>(window.size(), 1))
+    , _hop(std::max<size_t>(hop, 1))
+    , _type(type)
+    , _fft(std::max<size_t>(window.size(), 1))
+    , _window(window)
+    , _scale(1.0)
+    , _buf(std::max<size_t>(window.size(), 1))
+    , _fill(0)
+    , _skip(0)
+    , _scratch(std::max<size_t>(window.size(), 1))
+    {
+        _window.resize(_length, 1.0);
+
+        // Coherent Gain: a Sine of Amplitude A shows up as A (single-sided)
+        double sum = 0.0;
+        for (double w : _window) sum += w;
+
+        if (sum != 0.0) _scale = 2.0 / sum;
+    }
+
+
+    MlxSTFT::~MlxSTFT()
+    {
+    }
+
+
+    size_t MlxSTFT::frameLength() const
+    {
+        return _length;
+    }
+
+
+    size_t MlxSTFT::hop() const
+    {
+        return _hop;
+    }
+
+
+    size_t MlxSTFT::bins() const
+    {
+        return (_length / 2) + 1;
+    }
+
+
+    size_t MlxSTFT::framesFor(size_t n) const
+    {
+        if (n <= _skip) return 0;
+
+        const size_t avail = _fill + (n - _skip);
+        if (avail < _length) return 0;
+
+        // After each Frame another hop Samples complete the next one
+        return 1 + ((avail - _length) / _hop);
+    }
+
+
+    size_t MlxSTFT::process(const double *in, size_t n, double *out)
+    {
+        const size_t B = bins();
+        size_t frames = 0;
+        size_t pos = 0;
+
+        while (pos < n)
+        {
+            if (_skip > 0)
+            {
+                const size_t d = std::min(_skip, n - pos);
+                _skip -= d;
+                pos += d;
+                continue;
+            }
+
+            const size_t d = std::min(_length - _fill, n - pos);
+            std::copy(in + pos, in + pos + d, _buf.begin() + _fill);
+            _fill += d;
+            pos += d;
+
+            if (_fill < _length) break;
+
+            _emitFrame(out + (frames * B));
+            frames++;
+
+            if (_hop < _length)
+            {
+                std::copy(_buf.begin() + _hop, _buf.end(), _buf.begin());
+                _fill = _length - _hop;
+            }
+            else
+            {
+                _fill = 0;
+                _skip = _hop - _length;
+            }
+        }
+
+        return frames;
+    }
+
+
+    bool MlxSTFT::process(const double *in, size_t n, MlxFixedMatrix<double> &out, size_t &row)
+    {
+        if ((out.cols() != bins()) || (row > out.rows()) || (framesFor(n) > (out.rows() - row))) return false;
+
+        row += process(in, n, out.row(row));
+        return true;
+    }
+
+
+    void MlxSTFT::reset()
+    {
+        _fill = 0;
+        _skip = 0;
+    }
+
+
+    void MlxSTFT::_emitFrame(double *out)
+    {
+        const size_t N = _length;
+
+        for (size_t k = 0; k < N; k++) _scratch[k] = _buf[k] * _window[k];
+
+        _fft.transform(_scratch.data());
+
+        // Half Complex -> single-sided Spectrum; DC and Nyquist are not doubled
+        const double *d = _scratch.data();
+        const double half = 0.5 * _scale;
+
+        out[0] = half * fabs(d[0]);
+
+        for (size_t k = 1; k < bins(); k++)
+        {
+            const double re = d[(2 * k) - 1];
+            const double im = ((2 * k) < N) ? d[2 * k] : 0.0;
+
+            out[k] = _scale * sqrt((re * re) + (im * im));
+        }
+
+        if ((N % 2) == 0) out[N / 2] *= 0.5;
+
+        if (_type == MLX_SPECTRUM_POWER)
+        {
+            for (size_t k = 0; k < bins(); k++) out[k] *= out[k];
+        }
+    }
+
+
+}   /* namespace mlx */
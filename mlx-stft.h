@@ -0,0 +1,133 @@
+/**
+ * @file    mlx-stft.h
+ * @brief   Streaming Short-Time Fourier Transform / Spectrogram
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "structures/mlx-matrix.h"
+#include "mlx-fft.h"
+#include "mlx-window-function.h"
+
+
+namespace mlx
+{
+
+    typedef enum {
+        MLX_SPECTRUM_MAGNITUDE = 1,     // single-sided Amplitude, a Sine of Amplitude A gives A
+        MLX_SPECTRUM_POWER = 2,         // Square of the Magnitude
+    } SpectrumType_t;
+
+
+    /**
+     * @brief   Spectrogram of a continuous Stream
+     *
+     *  Samples may arrive in Chunks of any Size. Every hop Samples a Frame of
+     *  frameLength Samples is windowed, transformed with one owned Plan and written
+     *  as one Row of bins() Values into the Caller's Buffer. Hops larger than the
+     *  Frame skip Samples. Nothing is allocated after Construction.
+     */
+    class MlxSTFT
+    {
+    public:
+
+        /**
+         * @brief   Create STFT
+         *
+         * @param frameLength   Samples per Frame (FFT Length)
+         * @param hop           Samples between Frame Starts
+         * @param window        Window Function
+         * @param type          Spectrum Values
+         */
+        MlxSTFT(size_t frameLength, size_t hop, WindowType_t window = MLX_WINDOW_HANN, SpectrumType_t type = MLX_SPECTRUM_MAGNITUDE);
+
+        /**
+         * @brief   Create STFT with own Window Coefficients (Size is the Frame Length)
+         */
+        MlxSTFT(const std::vector<double> &window, size_t hop, SpectrumType_t type = MLX_SPECTRUM_MAGNITUDE);
+
+        ~MlxSTFT();
+
+
+        size_t frameLength() const;
+        size_t hop() const;
+
+        /**
+         * @brief   Values per Frame (DC ... Nyquist)
+         */
+        size_t bins() const;
+
+        /**
+         * @brief   Number of Frames the next n Samples will complete
+         */
+        size_t framesFor(size_t n) const;
+
+
+        /**
+         * @brief   Feed Samples
+         *
+         * @param in    Samples
+         * @param n     Number of Samples
+         * @param out   framesFor(n) x bins() Values
+         * @return      Number of Frames written
+         */
+        size_t process(const double *in, size_t n, double *out);
+
+        /**
+         * @brief   Feed Samples, Frames are written into out starting at Row row
+         *
+         * @param in    Samples
+         * @param n     Number of Samples
+         * @param out   time x bins() Matrix
+         * @param row   first free Row, advanced by the Number of Frames
+         * @return      false (and nothing consumed) if the Matrix is too small
+         */
+        bool process(const double *in, size_t n, MlxFixedMatrix<double> &out, size_t &row);
+
+
+        /**
+         * @brief   Drop buffered Samples
+         *
+         */
+        void reset();
+
+
+    protected:
+
+        void _emitFrame(double *out);
+
+        const size_t _length;
+        const size_t _hop;
+        const SpectrumType_t _type;
+
+        MlxMixedRadixRealFFT _fft;
+
+        std::vector<double> _window;
+        double _scale;
+
+        // Frame Buffer: _fill Samples collected, _skip Samples still to drop
+        std::vector<double> _buf;
+        size_t _fill;
+        size_t _skip;
+
+        std::vector<double> _scratch;
+
+
+    };  /* MlxSTFT */
+
+
+}   /* namespace mlx */
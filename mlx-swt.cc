@@ -0,0 +1,213 @@
+/**
+ * @file    mlx-swt.cc
+ * @brief   Streaming stationary (undecimated, à trous) Wavelet Transform
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#include "mlx-swt.h"
+#include "mlx-cpu-features.h"
+
+#include <math.h>
+#include <algorithm>
+
+
+namespace mlx
+{
+
+    namespace
+    {
+        /* a[i] = sum_k h[k] b[i + k D], d[i] = sum_k g[k] b[i + k D], Tap-outer */
+        inline __attribute__((always_inline))
+        void _mlx_swt_level(const double *__restrict b, size_t D, const double *h, const double *g, size_t taps, double *__restrict a, double *__restrict d, size_t n)
+        {
+            std::fill(a, a + n, 0.0);
+            std::fill(d, d + n, 0.0);
+
+            for (size_t k = 0; k < taps; k++)
+            {
+                const double hk = h[k];
+                const double gk = g[k];
+                const double *x = b + (k * D);
+
+                for (size_t i = 0; i < n; i++)
+                {
+                    a[i] += hk * x[i];
+                    d[i] += gk * x[i];
+                }
+            }
+        }
+
+
+#ifdef MLX_X86_DISPATCH
+        __attribute__((target("avx2,fma")))
+        void _mlx_swt_level_avx2(const double *__restrict b, size_t D, const double *h, const double *g, size_t taps, double *__restrict a, double *__restrict d, size_t n)
+        {
+            _mlx_swt_level(b, D, h, g, taps, a, d, n);
+        }
+#endif
+    }
+
+
+
+    MlxStationaryWaveletTransform::MlxStationaryWaveletTransform(std::shared_ptr<const MlxWaveletFilterBank> bank, size_t levels)
+    : _bank(bank)
+    , _levels(levels)
+    , _avx2(mlxCpuHasAvx2Fma())
+    {
+        _init();
+    }
+
+
+    MlxStationaryWaveletTransform::MlxStationaryWaveletTransform(WaveletTemplate_t family, size_t member, size_t levels)
+    : _bank(MlxWaveletRegistry::global().acquire(family, MlxWaveletRegistry::defaultAlpha(family, member), member))
+    , _levels(levels)
+    , _avx2(mlxCpuHasAvx2Fma())
+    {
+        _init();
+    }
+
+
+    MlxStationaryWaveletTransform::~MlxStationaryWaveletTransform()
+    {
+    }
+
+
+    void MlxStationaryWaveletTransform::_init()
+    {
+        if (!_bank || (_levels == 0)) return;
+
+        const gsl_wavelet *wvt = _bank->wavelet();
+        const size_t taps = wvt->nc;
+
+        // Unit DC Gain of the Lowpass, the Highpass gets the same Factor
+        double dc = 0.0;
+        for (size_t k = 0; k < taps; k++) dc += wvt->h1[k];
+
+        const double scale = (fabs(dc) > 0.0) ? (1.0 / dc) : 1.0;
+
+        _h.resize(taps);
+        _g.resize(taps);
+
+        for (size_t k = 0; k < taps; k++)
+        {
+            _h[k] = scale * wvt->h1[taps - 1 - k];
+            _g[k] = scale * wvt->g1[taps - 1 - k];
+        }
+
+        for (size_t j = 0; j < _levels; j++)
+        {
+            const size_t history = (taps - 1) << j;
+
+            _history.push_back(history);
+            _buf.emplace_back(history + MLX_SWT_BLOCK, 0.0);
+        }
+    }
+
+
+    bool MlxStationaryWaveletTransform::valid() const
+    {
+        return !_buf.empty();
+    }
+
+
+    size_t MlxStationaryWaveletTransform::levels() const
+    {
+        return _levels;
+    }
+
+
+    size_t MlxStationaryWaveletTransform::rows() const
+    {
+        return _levels + 1;
+    }
+
+
+    double MlxStationaryWaveletTransform::delay(size_t level) const
+    {
+        if (_h.empty()) return 0.0;
+
+        return (0.5 * (_h.size() - 1)) * (double(size_t(1) << level) - 1.0);
+    }
+
+
+    bool MlxStationaryWaveletTransform::process(const double *in, size_t n, double *out)
+    {
+        if (!valid()) return false;
+
+        for (size_t pos = 0; pos < n; pos += MLX_SWT_BLOCK)
+        {
+            const size_t len = std::min(MLX_SWT_BLOCK, n - pos);
+            _block(in + pos, len, out + pos, n);
+        }
+
+        return true;
+    }
+
+
+    bool MlxStationaryWaveletTransform::process(const double *in, size_t n, MlxFixedMatrix<double> &out, size_t &col)
+    {
+        if (!valid() || (out.rows() < rows()) || ((col + n) > out.cols())) return false;
+
+        for (size_t pos = 0; pos < n; pos += MLX_SWT_BLOCK)
+        {
+            const size_t len = std::min(MLX_SWT_BLOCK, n - pos);
+            _block(in + pos, len, out.data() + col + pos, out.cols());
+        }
+
+        col += n;
+        return true;
+    }
+
+
+    void MlxStationaryWaveletTransform::reset()
+    {
+        for (std::vector<double> &buf : _buf)
+        {
+            std::fill(buf.begin(), buf.end(), 0.0);
+        }
+    }
+
+
+    void MlxStationaryWaveletTransform::_block(const double *in, size_t n, double *out, size_t stride)
+    {
+        const size_t taps = _h.size();
+
+        std::copy(in, in + n, _buf[0].begin() + _history[0]);
+
+        for (size_t j = 0; j < _levels; j++)
+        {
+            double *b = _buf[j].data();
+            const size_t D = size_t(1) << j;
+
+            // Approximation feeds the next Level's Block, the last one goes to the Output
+            double *a = ((j + 1) < _levels) ? (_buf[j + 1].data() + _history[j + 1]) : (out + (_levels * stride));
+            double *d = out + (j * stride);
+
+#ifdef MLX_X86_DISPATCH
+            if (_avx2)
+            {
+                _mlx_swt_level_avx2(b, D, _h.data(), _g.data(), taps, a, d, n);
+            }
+            else
+#endif
+            {
+                _mlx_swt_level(b, D, _h.data(), _g.data(), taps, a, d, n);
+            }
+
+            // keep the last History Samples
+            std::copy(b + n, b + n + _history[j], b);
+        }
+    }
+
+
+}   /* namespace mlx */
@@ -0,0 +1,131 @@
+/**
+ * @file    mlx-swt.h
+ * @brief   Streaming stationary (undecimated, à trous) Wavelet Transform
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "structures/mlx-matrix.h"
+#include "mlx-wavelet-registry.h"
+
+
+namespace mlx
+{
+
+    /* Samples per Level and internal Block, Chunks of any Size are split into Blocks */
+    static const size_t MLX_SWT_BLOCK = 512;
+
+
+    /**
+     * @brief   Stationary Wavelet Transform of a continuous Stream
+     *
+     *  Level j filters the Approximation of Level j - 1 with the Analysis Filters of the
+     *  Filter Bank dilated by 2^(j-1) (Holes between the Taps), nothing is decimated, so
+     *  every Input Sample gives one Coefficient per Level and any Length works. Filters
+     *  are causal: Coefficient n only depends on Samples <= n, each Level keeps the last
+     *  (taps - 1) 2^(j-1) Approximations as State across Chunk Boundaries. Filters are
+     *  scaled to unit DC Gain of the Lowpass (Approximations keep the Signal's Scale).
+     *  Nothing is allocated after Construction.
+     */
+    class MlxStationaryWaveletTransform
+    {
+    public:
+
+        /**
+         * @brief   Create Transform
+         *
+         * @param bank      Filter Bank (see MlxWaveletRegistry)
+         * @param levels    Number of Levels (>= 1)
+         */
+        MlxStationaryWaveletTransform(std::shared_ptr<const MlxWaveletFilterBank> bank, size_t levels);
+
+        /**
+         * @brief   Create Transform on the Registry's Bank (Gauss Families with their default alpha)
+         */
+        MlxStationaryWaveletTransform(WaveletTemplate_t family, size_t member, size_t levels);
+
+        ~MlxStationaryWaveletTransform();
+
+
+        bool valid() const;
+        size_t levels() const;
+
+        /**
+         * @brief   Rows of the Output: Details d_1 ... d_J, then the Approximation a_J
+         */
+        size_t rows() const;
+
+        /**
+         * @brief   Group Delay of Level j (1 ... levels()) in Samples for linear-Phase Filters
+         */
+        double delay(size_t level) const;
+
+
+        /**
+         * @brief   Feed Samples
+         *
+         * @param in    n Samples
+         * @param n     Number of Samples
+         * @param out   rows() x n Values, Row r starts at out + r * n
+         * @return      false if the Transform is not valid
+         */
+        bool process(const double *in, size_t n, double *out);
+
+        /**
+         * @brief   Feed Samples, Coefficients are written into Columns col ... col + n - 1
+         *
+         * @param in    n Samples
+         * @param n     Number of Samples
+         * @param out   rows() x time Matrix
+         * @param col   first free Column, advanced by n
+         * @return      false (and nothing consumed) if the Matrix is too small
+         */
+        bool process(const double *in, size_t n, MlxFixedMatrix<double> &out, size_t &col);
+
+
+        /**
+         * @brief   Clear the Filter State of all Levels
+         *
+         */
+        void reset();
+
+
+    protected:
+
+        void _init();
+
+        /* One Block of at most MLX_SWT_BLOCK Samples, out with Row Stride stride */
+        void _block(const double *in, size_t n, double *out, size_t stride);
+
+        std::shared_ptr<const MlxWaveletFilterBank> _bank;
+        const size_t _levels;
+
+        // Analysis Filters, reversed and scaled: f[k] belongs to x[n - (taps - 1 - k) D]
+        std::vector<double> _h;
+        std::vector<double> _g;
+
+        // per Level: [History (taps - 1) D | Block], History first
+        std::vector<std::vector<double>> _buf;
+        std::vector<size_t> _history;
+
+        bool _avx2;
+
+
+    };  /* MlxStationaryWaveletTransform */
+
+
+}   /* namespace mlx */
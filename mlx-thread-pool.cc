@@ -0,0 +1,150 @@
+/**
+ * @file    mlx-thread-pool.cc
+ * @brief   Persistent Worker Pool for data-parallel Loops
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-thread-pool.h"
+
+#include <algorithm>
+
+
+namespace mlx
+{
+
+    /* Set while a Thread executes Work of a Pool - nested Loops run inline */
+    static thread_local bool _mlx_in_pool = false;
+
+
+    MlxThreadPool::MlxThreadPool(size_t threads)
+    : _fn(nullptr)
+    , _count(0)
+    , _next(0)
+    , _active(0)
+    , _generation(0)
+    , _stop(false)
+    {
+        if (threads == 0)
+        {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        for (size_t n = 1; n < threads; n++)
+        {
+            _threads.emplace_back(&MlxThreadPool::_worker, this);
+        }
+    }
+
+
+    MlxThreadPool::~MlxThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+
+        _wake.notify_all();
+
+        for (std::thread& t : _threads)
+        {
+            t.join();
+        }
+    }
+
+
+    size_t MlxThreadPool::size() const
+    {
+        return _threads.size() + 1;
+    }
+
+
+    MlxThreadPool& MlxThreadPool::global()
+    {
+        static MlxThreadPool pool;
+        return pool;
+    }
+
+
+    void MlxThreadPool::parallelFor(size_t count, const std::function<void(size_t)> &fn)
+    {
+        if (count == 0) return;
+
+        if (_mlx_in_pool || _threads.empty() || (count == 1))
+        {
+            for (size_t idx = 0; idx < count; idx++) fn(idx);
+            return;
+        }
+
+        std::lock_guard<std::mutex> submit(_submitMutex);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            _fn = &fn;
+            _count = count;
+            _next = 0;
+            _active = _threads.size();
+            _generation++;
+        }
+
+        _wake.notify_all();
+
+        _run();
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock, [this] { return _active == 0; });
+
+        _fn = nullptr;
+    }
+
+
+    void MlxThreadPool::_run()
+    {
+        _mlx_in_pool = true;
+
+        for (size_t idx = _next++; idx < _count; idx = _next++)
+        {
+            (*_fn)(idx);
+        }
+
+        _mlx_in_pool = false;
+    }
+
+
+    void MlxThreadPool::_worker()
+    {
+        size_t seen = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _wake.wait(lock, [this, seen] { return _stop || (_generation != seen); });
+
+                if (_stop) return;
+
+                seen = _generation;
+            }
+
+            _run();
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _active--;
+            }
+
+            _done.notify_one();
+        }
+    }
+
+
+}   /* namespace mlx */
@@ -0,0 +1,93 @@
+/**
+ * @file    mlx-thread-pool.h
+ * @brief   Persistent Worker Pool for data-parallel Loops
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+
+namespace mlx
+{
+
+    class MlxThreadPool final
+    {
+    public:
+
+        /**
+         * @brief   Create Pool
+         *
+         * @param threads   Number of Threads incl. the calling Thread (0: Hardware Concurrency)
+         */
+        MlxThreadPool(size_t threads = 0);
+        ~MlxThreadPool();
+
+        MlxThreadPool(const MlxThreadPool&) = delete;
+        void operator= (const MlxThreadPool&) = delete;
+
+
+        /**
+         * @brief   Number of Threads working on a Loop (incl. the calling Thread)
+         */
+        size_t size() const;
+
+
+        /**
+         * @brief   Run fn(idx) for all idx in [0, count), returns when all are done
+         *
+         *  The calling Thread takes part in the Work. Calls from inside a running
+         *  Loop are executed inline, concurrent Calls are serialized.
+         *
+         * @param count     Number of Work Items
+         * @param fn        Work Function
+         */
+        void parallelFor(size_t count, const std::function<void(size_t)> &fn);
+
+
+        /**
+         * @brief   Pool shared by the Library
+         */
+        static MlxThreadPool& global();
+
+
+    private:
+
+        void _worker();
+        void _run();
+
+        std::vector<std::thread> _threads;
+
+        std::mutex _submitMutex;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _done;
+
+        const std::function<void(size_t)> *_fn;
+        size_t _count;
+        std::atomic<size_t> _next;
+        size_t _active;
+        size_t _generation;
+        bool _stop;
+
+
+    };  /* MlxThreadPool */
+
+
+}   /* namespace mlx */
@@ -0,0 +1,354 @@
+/**
+ * @file    mlx-wavelet-denoise.cc
+ * @brief   Batched multi-channel Wavelet Denoising
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#include "mlx-wavelet-denoise.h"
+
+#include <math.h>
+#include <algorithm>
+
+
+namespace mlx
+{
+
+    MlxBatchWaveletDenoiser::MlxBatchWaveletDenoiser(WaveletTemplate_t family, size_t member, size_t length, size_t levels, MlxThreadPool &pool)
+    : _length(length)
+    , _levels(levels)
+    , _pool(pool)
+    , _bank(MlxWaveletRegistry::global().acquire(family, MlxWaveletRegistry::defaultAlpha(family, member), member))
+    , _wavelet(nullptr)
+    {
+        const size_t available = MlxLiftingDWT::maxLevels(length);
+        if (_levels == 0) _levels = available;
+
+        if (!_bank || (_levels == 0) || (_levels > available)) return;
+
+        // Gauss Filters are not orthogonal, Synthesis would not reconstruct the Signal
+        if ((family == MLX_WAVELET_GAUSS) || (family == MLX_WAVELET_GAUSS_CENTERED)) return;
+
+        _wavelet = _bank->wavelet();
+
+        // Lifting only where it reproduces GSL's Coefficients (as MlxWaveletTransformation)
+        const bool lifting = ((family == GSL_WAVELET_HAAR) || (family == GSL_WAVELET_DAUBECHIES)) && MlxLiftingDWT::supported(family, member);
+
+        _wrk.resize(std::max<size_t>(1, _pool.size()));
+
+        for (_workspace_t &wrk : _wrk)
+        {
+            if (lifting) wrk.lifting = std::make_unique<MlxLiftingDWT>(family, member, length);
+            wrk.scratch.resize(length);
+        }
+    }
+
+
+    MlxBatchWaveletDenoiser::~MlxBatchWaveletDenoiser()
+    {
+    }
+
+
+    bool MlxBatchWaveletDenoiser::valid() const
+    {
+        return (_wavelet != nullptr);
+    }
+
+
+    size_t MlxBatchWaveletDenoiser::length() const
+    {
+        return _length;
+    }
+
+
+    size_t MlxBatchWaveletDenoiser::levels() const
+    {
+        return _levels;
+    }
+
+
+    const std::shared_ptr<const MlxWaveletFilterBank>& MlxBatchWaveletDenoiser::filterBank() const
+    {
+        return _bank;
+    }
+
+
+    const std::vector<double>& MlxBatchWaveletDenoiser::sigma() const
+    {
+        return _sigma;
+    }
+
+
+    bool MlxBatchWaveletDenoiser::denoise(const double *in, size_t channels, double *out, WaveletThreshold_t mode, double scale)
+    {
+        if (!valid()) return false;
+
+        _sigma.resize(channels);
+        if (channels == 0) return true;
+
+        // Contiguous Blocks of Channels, every Worker on its own Workspace
+        const size_t workers = (channels < MLX_WVT_DENOISE_MIN_PARALLEL) ? 1 : std::min(_wrk.size(), channels);
+        const size_t block = (channels + workers - 1) / workers;
+
+        auto work = [&](size_t w)
+        {
+            const size_t first = w * block;
+            const size_t last = std::min(channels, first + block);
+
+            for (size_t c = first; c < last; c++)
+            {
+                double *row = out + (c * _length);
+                if (in != out) std::copy(in + (c * _length), in + ((c + 1) * _length), row);
+
+                _sigma[c] = _channel(_wrk[w], row, mode, scale);
+            }
+        };
+
+        if (workers == 1)
+        {
+            work(0);
+        }
+        else
+        {
+            _pool.parallelFor(workers, work);
+        }
+
+        return true;
+    }
+
+
+    bool MlxBatchWaveletDenoiser::denoise(MlxFixedMatrix<double> &channels, WaveletThreshold_t mode, double scale)
+    {
+        if (channels.cols() != _length) return false;
+
+        return denoise(channels.data(), channels.rows(), channels.data(), mode, scale);
+    }
+
+
+    double MlxBatchWaveletDenoiser::sureThreshold(double *x, size_t n)
+    {
+        if (n < 2) return 0.0;
+
+        const double universal = sqrt(2.0 * log(double(n)));
+
+        double energy = 0.0;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] *= x[i];
+            energy += x[i];
+        }
+
+        // sparse Levels: SURE is unreliable, the universal Threshold is used (Donoho & Johnstone)
+        const double eta = (energy - n) / n;
+        const double crit = pow(log2(double(n)), 1.5) / sqrt(double(n));
+
+        if (eta <= crit) return universal;
+
+        std::sort(x, x + n);
+
+        // Risk(t^2 = x_k) = n - 2 (k + 1) + sum_{i <= k} x_i + (n - k - 1) x_k
+        double best = INFINITY;
+        double t2 = 0.0;
+        double sum = 0.0;
+
+        for (size_t k = 0; k < n; k++)
+        {
+            sum += x[k];
+
+            const double risk = double(n) - (2.0 * (k + 1)) + sum + (double(n - k - 1) * x[k]);
+
+            if (risk < best)
+            {
+                best = risk;
+                t2 = x[k];
+            }
+        }
+
+        return std::min(sqrt(t2), universal);
+    }
+
+
+    double MlxBatchWaveletDenoiser::_channel(_workspace_t &wrk, double *data, WaveletThreshold_t mode, double scale)
+    {
+        const size_t n = _length;
+        double *scratch = wrk.scratch.data();
+
+        if (wrk.lifting)
+        {
+            wrk.lifting->forward(data, n, _levels);
+        }
+        else
+        {
+            for (size_t l = 0; l < _levels; l++)
+            {
+                _forwardStep(data, (n >> l) / 2, scratch);
+            }
+        }
+
+        // Noise Level: Median of |d_1|
+        const size_t h1 = n / 2;
+
+        for (size_t i = 0; i < h1; i++) scratch[i] = fabs(data[h1 + i]);
+
+        std::nth_element(scratch, scratch + (h1 / 2), scratch + h1);
+        double median = scratch[h1 / 2];
+
+        if ((h1 % 2) == 0)
+        {
+            median = 0.5 * (median + *std::max_element(scratch, scratch + (h1 / 2)));
+        }
+
+        const double sigma = median / MLX_WVT_MAD_NORMAL;
+        const double universal = scale * sigma * sqrt(2.0 * log(double(n)));
+
+        // coarsest Level first: threshold d_l, then synthesize [s_l | d_l] -> s_(l-1)
+        for (size_t l = _levels; l > 0; l--)
+        {
+            const size_t h = n >> l;
+            double *d = data + h;
+
+            double t = universal;
+
+            if ((mode == MLX_WVT_THRESHOLD_SURE) && (sigma > 0.0))
+            {
+                for (size_t i = 0; i < h; i++) scratch[i] = d[i] / sigma;
+                t = scale * sigma * sureThreshold(scratch, h);
+            }
+
+            _threshold(d, h, t, mode);
+
+            if (wrk.lifting)
+            {
+                wrk.lifting->inverse(data, 2 * h, 1);
+            }
+            else
+            {
+                _inverseStep(data, h, scratch);
+            }
+        }
+
+        return sigma;
+    }
+
+
+    void MlxBatchWaveletDenoiser::_threshold(double *d, size_t h, double t, WaveletThreshold_t mode) const
+    {
+        if (mode == MLX_WVT_THRESHOLD_HARD)
+        {
+            for (size_t i = 0; i < h; i++)
+            {
+                if (fabs(d[i]) <= t) d[i] = 0.0;
+            }
+
+            return;
+        }
+
+        for (size_t i = 0; i < h; i++)
+        {
+            const double x = d[i];
+            d[i] = (x > t) ? (x - t) : ((x < -t) ? (x + t) : 0.0);
+        }
+    }
+
+
+    void MlxBatchWaveletDenoiser::_forwardStep(double *data, size_t h, double *scratch) const
+    {
+        const size_t n = 2 * h;
+        const size_t nc = _wavelet->nc;
+        const double *h1 = _wavelet->h1;
+        const double *g1 = _wavelet->g1;
+
+        // Filter i starts at (2 i + nc n - offset) mod n
+        const size_t base = (n - (_wavelet->offset % n)) % n;
+
+        for (size_t i = 0; i < h; i++)
+        {
+            size_t j = (2 * i) + base;
+            if (j >= n) j -= n;
+
+            double a = 0.0;
+            double g = 0.0;
+
+            if ((j + nc) <= n)
+            {
+                const double *x = data + j;
+
+                for (size_t k = 0; k < nc; k++)
+                {
+                    a += h1[k] * x[k];
+                    g += g1[k] * x[k];
+                }
+            }
+            else
+            {
+                for (size_t k = 0; k < nc; k++)
+                {
+                    a += h1[k] * data[j];
+                    g += g1[k] * data[j];
+
+                    if (++j == n) j = 0;
+                }
+            }
+
+            scratch[i] = a;
+            scratch[i + h] = g;
+        }
+
+        std::copy(scratch, scratch + n, data);
+    }
+
+
+    void MlxBatchWaveletDenoiser::_inverseStep(double *data, size_t h, double *scratch) const
+    {
+        const size_t n = 2 * h;
+        const size_t nc = _wavelet->nc;
+        const double *h2 = _wavelet->h2;
+        const double *g2 = _wavelet->g2;
+
+        const size_t base = (n - (_wavelet->offset % n)) % n;
+
+        std::fill(scratch, scratch + n, 0.0);
+
+        for (size_t i = 0; i < h; i++)
+        {
+            const double a = data[i];
+            const double d = data[i + h];
+
+            size_t j = (2 * i) + base;
+            if (j >= n) j -= n;
+
+            if ((j + nc) <= n)
+            {
+                double *x = scratch + j;
+
+                for (size_t k = 0; k < nc; k++)
+                {
+                    x[k] += (h2[k] * a) + (g2[k] * d);
+                }
+            }
+            else
+            {
+                for (size_t k = 0; k < nc; k++)
+                {
+                    scratch[j] += (h2[k] * a) + (g2[k] * d);
+
+                    if (++j == n) j = 0;
+                }
+            }
+        }
+
+        std::copy(scratch, scratch + n, data);
+    }
+
+
+}   /* namespace mlx */
@@ -0,0 +1,155 @@
+/**
+ * @file    mlx-wavelet-denoise.h
+ * @brief   Batched multi-channel Wavelet Denoising
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "structures/mlx-matrix.h"
+#include "mlx-wavelet-registry.h"
+#include "mlx-lifting-dwt.h"
+#include "mlx-thread-pool.h"
+
+
+namespace mlx
+{
+
+    typedef enum {
+        MLX_WVT_THRESHOLD_SOFT = 1,     // sign(x) max(|x| - t, 0), universal t
+        MLX_WVT_THRESHOLD_HARD,         // x if |x| > t, universal t
+        MLX_WVT_THRESHOLD_SURE          // soft, t per Level by SureShrink (hybrid)
+    } WaveletThreshold_t;
+
+
+    /* Channels below this Count are denoised on the calling Thread */
+    static const size_t MLX_WVT_DENOISE_MIN_PARALLEL = 4;
+
+    /* Median of |d_1| / MLX_WVT_MAD_NORMAL is the Noise Level of Gaussian Noise */
+    static const double MLX_WVT_MAD_NORMAL = 0.6744897501960817;
+
+
+    /**
+     * @brief   Decompose, threshold and reconstruct many equal-length Channels
+     *
+     *  Channels are the Rows of a channels x length Buffer (one contiguous Signal per
+     *  Row) and share one Filter Bank from the Registry. Per Channel the Decomposition
+     *  runs in the Row (GSL Layout, periodic Boundaries), the Noise Level comes from
+     *  the finest Details (MAD), and the Reconstruction walks from the coarsest Level
+     *  to the finest, thresholding each Level's Details right before its Synthesis
+     *  Step. Haar and Daubechies 2 / 4 use the Lifting Scheme (see MlxLiftingDWT),
+     *  the other Families the Filter Bank with GSL's Coefficients and Phase. The Gauss
+     *  Families do not reconstruct perfectly and are rejected.
+     *
+     *  Channels are split into contiguous Blocks across the Thread Pool, every Worker
+     *  owns its Workspace (allocated once at Construction). One Denoiser must not be
+     *  used from several Threads at once.
+     */
+    class MlxBatchWaveletDenoiser
+    {
+    public:
+
+        /**
+         * @brief   Create Denoiser, check valid() before use
+         *
+         * @param family    Wavelet Family (Haar, Daubechies, B-Spline)
+         * @param member    Family Member
+         * @param length    Samples per Channel (divisible by 2^levels)
+         * @param levels    Decomposition Levels, 0 for MlxLiftingDWT::maxLevels(length)
+         * @param pool      Worker Threads
+         */
+        MlxBatchWaveletDenoiser(WaveletTemplate_t family, size_t member, size_t length, size_t levels = 0,
+            MlxThreadPool &pool = MlxThreadPool::global());
+        ~MlxBatchWaveletDenoiser();
+
+        MlxBatchWaveletDenoiser(const MlxBatchWaveletDenoiser&) = delete;
+        void operator= (const MlxBatchWaveletDenoiser&) = delete;
+
+
+        bool valid() const;
+        size_t length() const;
+        size_t levels() const;
+
+        const std::shared_ptr<const MlxWaveletFilterBank>& filterBank() const;
+
+
+        /**
+         * @brief   Denoise Channels
+         *
+         * @param in        channels x length() Samples (may equal out)
+         * @param channels  Number of Channels
+         * @param out       channels x length() Values
+         * @param mode      Threshold Rule
+         * @param scale     Factor on the Threshold
+         * @return          false if the Denoiser is not valid
+         */
+        bool denoise(const double *in, size_t channels, double *out, WaveletThreshold_t mode = MLX_WVT_THRESHOLD_SOFT, double scale = 1.0);
+
+        /**
+         * @brief   Denoise the Rows of a Matrix in-place
+         */
+        bool denoise(MlxFixedMatrix<double> &channels, WaveletThreshold_t mode = MLX_WVT_THRESHOLD_SOFT, double scale = 1.0);
+
+
+        /**
+         * @brief   Noise Level (MAD of the finest Details) per Channel of the last Call
+         */
+        const std::vector<double>& sigma() const;
+
+
+        /**
+         * @brief   SureShrink Threshold for Coefficients of unit Noise Level
+         *
+         * @param x     Coefficients, overwritten (sorted Squares)
+         * @param n     Number of Coefficients
+         * @return      Threshold, capped at the universal sqrt(2 ln n)
+         */
+        static double sureThreshold(double *x, size_t n);
+
+
+    protected:
+
+        struct _workspace_t
+        {
+            std::unique_ptr<MlxLiftingDWT> lifting;
+            std::vector<double> scratch;
+        };
+
+        /* One Channel in-place, returns the Noise Level */
+        double _channel(_workspace_t &wrk, double *data, WaveletThreshold_t mode, double scale);
+
+        /* Filter Bank Form of one Level on the first 2h Values, GSL's dwt_step */
+        void _forwardStep(double *data, size_t h, double *scratch) const;
+        void _inverseStep(double *data, size_t h, double *scratch) const;
+
+        void _threshold(double *d, size_t h, double t, WaveletThreshold_t mode) const;
+
+        const size_t _length;
+        size_t _levels;
+
+        MlxThreadPool &_pool;
+
+        std::shared_ptr<const MlxWaveletFilterBank> _bank;
+        const gsl_wavelet *_wavelet;
+
+        std::vector<_workspace_t> _wrk;
+        std::vector<double> _sigma;
+
+
+    };  /* MlxBatchWaveletDenoiser */
+
+
+}   /* namespace mlx */
@@ -0,0 +1,296 @@
+/**
+ * @file    mlx-wavelet-registry.cc
+ * @brief   Thread-safe Registry of immutable Wavelet Filter Banks
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#include "mlx-wavelet-registry.h"
+#include "wavelets/mlx-wvt-gauss.h"
+
+#include <gsl/gsl_errno.h>
+
+
+namespace mlx
+{
+
+    namespace
+    {
+
+        /* GSL Type with static Coefficient Tables, nullptr for the Gauss Families */
+        const gsl_wavelet_type* _mlx_gsl_type(WaveletTemplate_t family)
+        {
+            switch (family)
+            {
+                case GLS_WAVELET_BSPLINE:               return gsl_wavelet_bspline;
+                case GLS_WAVELET_BSPLINE_CENTERED:      return gsl_wavelet_bspline_centered;
+                case GSL_WAVELET_DAUBECHIES:            return gsl_wavelet_daubechies;
+                case GSL_WAVELET_DAUBECHIES_CENTERED:   return gsl_wavelet_daubechies_centered;
+                case GSL_WAVELET_HAAR:                  return gsl_wavelet_haar;
+                case GSL_WAVELET_HAAR_CENTERED:         return gsl_wavelet_haar_centered;
+                default:                                return nullptr;
+            }
+        }
+
+
+        bool _mlx_gauss_family(WaveletTemplate_t family)
+        {
+            return (family == MLX_WAVELET_GAUSS) || (family == MLX_WAVELET_GAUSS_CENTERED);
+        }
+
+    }   /* anonymous namespace */
+
+
+
+/// Start - Filter Bank
+
+
+    MlxWaveletFilterBank::MlxWaveletFilterBank(WaveletTemplate_t family, double alpha, size_t member)
+    : _family(family)
+    , _alpha(_mlx_gauss_family(family) ? alpha : 0.0)
+    , _member(member)
+    , _wavelet {}
+    , _valid(false)
+    {
+        if (member == 0) return;
+
+        if (const gsl_wavelet_type *type = _mlx_gsl_type(family))
+        {
+            // GSL Tables are static, only the Pointers are taken over
+            _wavelet.type = type;
+            _valid = (type->init(&_wavelet.h1, &_wavelet.g1, &_wavelet.h2, &_wavelet.g2, &_wavelet.nc, &_wavelet.offset, member) == GSL_SUCCESS);
+            return;
+        }
+
+        if (!_mlx_gauss_family(family) || !(alpha > 0.0)) return;
+
+        const bool centered = (family == MLX_WAVELET_GAUSS_CENTERED);
+        const size_t N = centered ? MLX_WVT_GAUSS_CENTERED_LENGTH : (2 * member);
+
+        _h.resize(N);
+        _g.resize(N);
+        mlx_gauss_wavelet_coefficients(alpha, N, centered ? -1.0 : 1.0, _h.data(), _g.data());
+
+        _wavelet.type = centered ? mlx_wavelet_gaussian_centered : mlx_wavelet_gaussian;
+        _wavelet.h1 = _h.data();
+        _wavelet.g1 = _g.data();
+        _wavelet.h2 = _h.data();
+        _wavelet.g2 = _g.data();
+        _wavelet.nc = N;
+        _wavelet.offset = centered ? (N >> 1) : 0;
+
+        _valid = true;
+    }
+
+
+    MlxWaveletFilterBank::~MlxWaveletFilterBank()
+    {
+    }
+
+
+    bool MlxWaveletFilterBank::valid() const
+    {
+        return _valid;
+    }
+
+
+    WaveletTemplate_t MlxWaveletFilterBank::family() const
+    {
+        return _family;
+    }
+
+
+    double MlxWaveletFilterBank::alpha() const
+    {
+        return _alpha;
+    }
+
+
+    size_t MlxWaveletFilterBank::member() const
+    {
+        return _member;
+    }
+
+
+    size_t MlxWaveletFilterBank::length() const
+    {
+        return _wavelet.nc;
+    }
+
+
+    const gsl_wavelet* MlxWaveletFilterBank::wavelet() const
+    {
+        return &_wavelet;
+    }
+
+
+    size_t MlxWaveletFilterBank::bytes() const
+    {
+        return sizeof(*this) + ((_h.size() + _g.size()) * sizeof(double));
+    }
+
+
+    bool MlxWaveletFilterBank::supported(WaveletTemplate_t family, size_t member)
+    {
+        if (member == 0) return false;
+        if (_mlx_gauss_family(family)) return true;
+
+        const gsl_wavelet_type *type = _mlx_gsl_type(family);
+        if (type == nullptr) return false;
+
+        const double *h1, *g1, *h2, *g2;
+        size_t nc, offset;
+
+        return (type->init(&h1, &g1, &h2, &g2, &nc, &offset, member) == GSL_SUCCESS);
+    }
+
+
+/// END - Filter Bank
+
+
+
+/// Start - Registry
+
+
+    MlxWaveletRegistry::MlxWaveletRegistry()
+    {
+    }
+
+
+    MlxWaveletRegistry::~MlxWaveletRegistry()
+    {
+    }
+
+
+    MlxWaveletRegistry& MlxWaveletRegistry::global()
+    {
+        static MlxWaveletRegistry registry;
+        return registry;
+    }
+
+
+    double MlxWaveletRegistry::defaultAlpha(WaveletTemplate_t family, size_t member)
+    {
+        if (family == MLX_WAVELET_GAUSS) return MLX_WAVELET_GAUSS_ALPHA;
+        if ((family == MLX_WAVELET_GAUSS_CENTERED) && (member > 0)) return double(MLX_WVT_GAUSS_CENTERED_LENGTH) / member;
+
+        return 0.0;
+    }
+
+
+    std::shared_ptr<const MlxWaveletFilterBank> MlxWaveletRegistry::acquire(WaveletTemplate_t family, double alpha, size_t member)
+    {
+        return _lookup(family, alpha, member, false);
+    }
+
+
+    std::shared_ptr<const MlxWaveletFilterBank> MlxWaveletRegistry::pin(WaveletTemplate_t family, double alpha, size_t member)
+    {
+        return _lookup(family, alpha, member, true);
+    }
+
+
+    size_t MlxWaveletRegistry::entries() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        size_t res = _pinned.size();
+
+        for (const auto &entry : _banks)
+        {
+            if (_pinned.count(entry.first) == 0) res++;
+        }
+
+        return res;
+    }
+
+
+    size_t MlxWaveletRegistry::bytes() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        size_t res = 0;
+
+        for (const auto &entry : _pinned) res += entry.second->bytes();
+
+        for (const auto &entry : _banks)
+        {
+            if (_pinned.count(entry.first) == 0) res += entry.second->bytes();
+        }
+
+        return res;
+    }
+
+
+    void MlxWaveletRegistry::clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _banks.clear();
+    }
+
+
+    std::shared_ptr<const MlxWaveletFilterBank> MlxWaveletRegistry::_lookup(WaveletTemplate_t family, double alpha, size_t member, bool pin)
+    {
+        const _key_t key { int(family), _mlx_gauss_family(family) ? alpha : 0.0, member };
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        std::shared_ptr<const MlxWaveletFilterBank> bank;
+
+        if (auto search = _banks.find(key); search != _banks.end())
+        {
+            bank = search->second;
+        }
+        else if (auto search = _pinned.find(key); search != _pinned.end())
+        {
+            bank = search->second;
+            _banks.emplace(key, bank);
+        }
+        else
+        {
+            // Tables are small (at most a few hundred Values), built under the Lock
+            bank = std::make_shared<const MlxWaveletFilterBank>(family, alpha, member);
+            if (!bank->valid()) return nullptr;
+
+            _banks.emplace(key, bank);
+        }
+
+        if (pin) _pinned.emplace(key, bank);
+
+        return bank;
+    }
+
+
+/// END - Registry
+
+
+}   /* namespace mlx */
+
+
+
+extern "C" int mlx_wavelet_registry_tables(int family, double alpha, size_t member, const double **h1, const double **g1,
+    const double **h2, const double **g2, size_t *nc, size_t *offset)
+{
+    std::shared_ptr<const mlx::MlxWaveletFilterBank> bank = mlx::MlxWaveletRegistry::global().pin(mlx::WaveletTemplate_t(family), alpha, member);
+    if (!bank) return GSL_EINVAL;
+
+    const gsl_wavelet *wvt = bank->wavelet();
+
+    *h1 = wvt->h1;
+    *g1 = wvt->g1;
+    *h2 = wvt->h2;
+    *g2 = wvt->g2;
+    *nc = wvt->nc;
+    *offset = wvt->offset;
+
+    return GSL_SUCCESS;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file    mlx-wavelet-registry.h
+ * @brief   Thread-safe Registry of immutable Wavelet Filter Banks
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+#include <memory>
+
+#include <gsl/gsl_wavelet.h>
+
+
+namespace mlx
+{
+
+    typedef enum {
+        MLX_WAVELET_GAUSS = 1,
+        MLX_WAVELET_GAUSS_CENTERED = 11,
+        GLS_WAVELET_BSPLINE = 2,
+        GLS_WAVELET_BSPLINE_CENTERED = 21,
+        GSL_WAVELET_DAUBECHIES = 3,
+        GSL_WAVELET_DAUBECHIES_CENTERED = 31,
+        GSL_WAVELET_HAAR = 4,
+        GSL_WAVELET_HAAR_CENTERED = 41,
+    } WaveletTemplate_t;
+
+
+    /* Width of MLX_WAVELET_GAUSS (the centered Variant derives it from the Member) */
+    static const double MLX_WAVELET_GAUSS_ALPHA = 10.5;
+
+
+    /**
+     * @brief   Coefficients of one Wavelet (Family, alpha, Member), never modified after Construction
+     *
+     *  wavelet() is a GSL Wavelet pointing into the owned Tables (Gauss) or into GSL's
+     *  static Tables, it can be handed to gsl_wavelet_transform_* from any Thread.
+     */
+    class MlxWaveletFilterBank final
+    {
+    public:
+
+        /**
+         * @brief   Build Filter Bank, check valid() before use
+         *
+         * @param family    Wavelet Family
+         * @param alpha     Gauss Width (MLX_WAVELET_GAUSS only, the centered Variant uses
+         *                  MLX_WVT_GAUSS_CENTERED_LENGTH / member)
+         * @param member    GSL Member (Gauss: Half Length)
+         */
+        MlxWaveletFilterBank(WaveletTemplate_t family, double alpha, size_t member);
+        ~MlxWaveletFilterBank();
+
+        MlxWaveletFilterBank(const MlxWaveletFilterBank&) = delete;
+        void operator= (const MlxWaveletFilterBank&) = delete;
+
+
+        bool valid() const;
+
+        WaveletTemplate_t family() const;
+        double alpha() const;
+        size_t member() const;
+
+        /**
+         * @brief   Number of Coefficients
+         */
+        size_t length() const;
+
+        const gsl_wavelet* wavelet() const;
+
+        size_t bytes() const;
+
+
+        /**
+         * @brief   true if GSL accepts the Member for the Family
+         */
+        static bool supported(WaveletTemplate_t family, size_t member);
+
+
+    private:
+
+        const WaveletTemplate_t _family;
+        const double _alpha;
+        const size_t _member;
+
+        std::vector<double> _h;
+        std::vector<double> _g;
+
+        gsl_wavelet _wavelet;
+        bool _valid;
+
+
+    };  /* MlxWaveletFilterBank */
+
+
+
+    /**
+     * @brief   Builds every Filter Bank once and shares it
+     *
+     *  acquire() returns the same immutable Bank for the same (Family, alpha, Member)
+     *  on all Threads. clear() drops the Registry's References, Banks still held by a
+     *  Transformation are freed with its last Reference. Banks handed to GSL through
+     *  mlx_wavelet_gaussian(_centered) (raw Pointers) are kept until the Registry is
+     *  destroyed.
+     */
+    class MlxWaveletRegistry final
+    {
+    public:
+
+        MlxWaveletRegistry();
+        ~MlxWaveletRegistry();
+
+        MlxWaveletRegistry(const MlxWaveletRegistry&) = delete;
+        void operator= (const MlxWaveletRegistry&) = delete;
+
+
+        /**
+         * @brief   Get the shared Filter Bank
+         *
+         * @param family    Wavelet Family
+         * @param alpha     Gauss Width (ignored by the other Families)
+         * @param member    GSL Member
+         * @return          Bank, nullptr if the Member is not supported
+         */
+        std::shared_ptr<const MlxWaveletFilterBank> acquire(WaveletTemplate_t family, double alpha, size_t member);
+
+        /**
+         * @brief   Same as acquire(), the Bank is kept for the Lifetime of the Registry
+         */
+        std::shared_ptr<const MlxWaveletFilterBank> pin(WaveletTemplate_t family, double alpha, size_t member);
+
+
+        size_t entries() const;
+        size_t bytes() const;
+
+        /**
+         * @brief   Drop all unpinned Banks
+         *
+         */
+        void clear();
+
+
+        /**
+         * @brief   Registry shared by the Library
+         */
+        static MlxWaveletRegistry& global();
+
+
+        /**
+         * @brief   alpha used by MlxWaveletTransformation: MLX_WAVELET_GAUSS_ALPHA for Gauss,
+         *          MLX_WVT_GAUSS_CENTERED_LENGTH / member for centered Gauss, 0 otherwise
+         */
+        static double defaultAlpha(WaveletTemplate_t family, size_t member);
+
+
+    private:
+
+        typedef std::tuple<int, double, size_t> _key_t;
+
+        std::shared_ptr<const MlxWaveletFilterBank> _lookup(WaveletTemplate_t family, double alpha, size_t member, bool pin);
+
+        mutable std::mutex _mutex;
+
+        std::map<_key_t, std::shared_ptr<const MlxWaveletFilterBank>> _banks;
+        std::map<_key_t, std::shared_ptr<const MlxWaveletFilterBank>> _pinned;
+
+
+    };  /* MlxWaveletRegistry */
+
+
+}   /* namespace mlx */
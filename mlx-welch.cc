@@ -0,0 +1,234 @@
+/**
+ * @file    mlx-welch.cc
+ * @brief   Power Spectral Density by Welch's Method
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-welch.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+namespace mlx
+{
+
+    /* Ratio Median / Mean of a chi^2 (2 DOF) Sample of Size n (as scipy _median_bias) */
+    static double _medianBias(size_t n)
+    {
+        double bias = 1.0;
+
+        for (size_t k = 1; k <= ((n - 1) / 2); k++)
+        {
+            const double ii = 2.0 * k;
+            bias += (1.0 / (ii + 1.0)) - (1.0 / ii);
+        }
+
+        return bias;
+    }
+
+
+    MlxWelchPSD::MlxWelchPSD(size_t segmentLength, size_t overlap, WindowType_t window, DetrendType_t detrend, AverageType_t average, MlxThreadPool &pool)
+    : _length(std::max<size_t>(segmentLength, 1))
+    , _overlap(std::min(overlap, std::max<size_t>(segmentLength, 1) - 1))
+    , _detrend(detrend)
+    , _average(average)
+    , _pool(pool)
+    , _window(windowFunction(window, std::max<size_t>(segmentLength, 1)))
+    , _windowPower(0.0)
+    {
+        if (_window.size() != _length) _window.assign(_length, 1.0);
+
+        for (double w : _window) _windowPower += w * w;
+
+        _psd.resize(bins());
+    }
+
+
+    MlxWelchPSD::~MlxWelchPSD()
+    {
+    }
+
+
+    size_t MlxWelchPSD::segmentLength() const
+    {
+        return _length;
+    }
+
+
+    size_t MlxWelchPSD::overlap() const
+    {
+        return _overlap;
+    }
+
+
+    size_t MlxWelchPSD::bins() const
+    {
+        return (_length / 2) + 1;
+    }
+
+
+    size_t MlxWelchPSD::segments(size_t n) const
+    {
+        if (n < _length) return 0;
+
+        return 1 + ((n - _length) / (_length - _overlap));
+    }
+
+
+    bool MlxWelchPSD::compute(const double *in, size_t n, double fs, double *psd)
+    {
+        const size_t S = segments(n);
+        const size_t B = bins();
+        const size_t step = _length - _overlap;
+
+        if ((S == 0) || (fs <= 0.0)) return false;
+
+        const size_t workers = std::min(_pool.size(), S);
+        const size_t block = (S + workers - 1) / workers;
+
+        // Median needs every Periodogram, Mean one Partial Sum per Worker
+        const bool median = (_average == MLX_AVERAGE_MEDIAN);
+        _stack.assign((median ? S : workers) * B, 0.0);
+
+        auto work = [&](size_t w)
+        {
+            const size_t first = w * block;
+            const size_t last = std::min(S, first + block);
+            if (first >= last) return;
+
+            std::shared_ptr<MlxMixedRadixRealFFT> plan = MlxFFTPlanCache::global().acquire(_length);
+            std::vector<double> buf(_length);
+            std::vector<double> pgram(B);
+
+            for (size_t seg = first; seg < last; seg++)
+            {
+                double *dst = median ? &_stack[seg * B] : pgram.data();
+                _periodogram(in + (seg * step), buf.data(), *plan, dst);
+
+                if (!median)
+                {
+                    double *sum = &_stack[w * B];
+                    for (size_t k = 0; k < B; k++) sum[k] += pgram[k];
+                }
+            }
+        };
+
+        if (workers == 1) work(0);
+        else _pool.parallelFor(workers, work);
+
+        // One-sided Density: Power / (fs * sum(w^2)), doubled except DC and Nyquist
+        const double scale = 1.0 / (fs * _windowPower);
+
+        if (median)
+        {
+            const double bias = _medianBias(S);
+            std::vector<double> column(S);
+
+            for (size_t k = 0; k < B; k++)
+            {
+                for (size_t seg = 0; seg < S; seg++) column[seg] = _stack[(seg * B) + k];
+
+                std::nth_element(column.begin(), column.begin() + (S / 2), column.end());
+                double med = column[S / 2];
+
+                if ((S % 2) == 0)
+                {
+                    const double lower = *std::max_element(column.begin(), column.begin() + (S / 2));
+                    med = 0.5 * (med + lower);
+                }
+
+                psd[k] = scale * med / bias;
+            }
+        }
+        else
+        {
+            for (size_t k = 0; k < B; k++)
+            {
+                double sum = 0.0;
+                for (size_t w = 0; w < workers; w++) sum += _stack[(w * B) + k];
+
+                psd[k] = scale * sum / S;
+            }
+        }
+
+        for (size_t k = 1; k < B; k++)
+        {
+            if (((_length % 2) == 0) && (k == (B - 1))) break;
+            psd[k] *= 2.0;
+        }
+
+        return true;
+    }
+
+
+    bool MlxWelchPSD::computeBands(const double *in, size_t n, double fs, double df, double *bands)
+    {
+        if ((df <= 0.0) || !compute(in, n, fs, _psd.data())) return false;
+
+        const double binWidth = fs / _length;
+        integrateSpectralBands(_psd.data(), bins(), binWidth, df, binWidth, bands);
+
+        return true;
+    }
+
+
+    /* |FFT(w * detrend(x))|^2 per Bin */
+    void MlxWelchPSD::_periodogram(const double *segment, double *work, MlxMixedRadixRealFFT &plan, double *out) const
+    {
+        const size_t N = _length;
+
+        double a = 0.0;     // Offset
+        double b = 0.0;     // Slope over centered Index
+
+        if (_detrend != MLX_DETREND_NONE)
+        {
+            for (size_t k = 0; k < N; k++) a += segment[k];
+            a /= N;
+        }
+
+        if ((_detrend == MLX_DETREND_LINEAR) && (N > 1))
+        {
+            const double c = 0.5 * (N - 1);
+            double sxy = 0.0;
+            double sxx = 0.0;
+
+            for (size_t k = 0; k < N; k++)
+            {
+                sxy += (k - c) * segment[k];
+                sxx += (k - c) * (k - c);
+            }
+
+            b = sxy / sxx;
+
+            for (size_t k = 0; k < N; k++) work[k] = _window[k] * (segment[k] - a - (b * (k - c)));
+        }
+        else
+        {
+            for (size_t k = 0; k < N; k++) work[k] = _window[k] * (segment[k] - a);
+        }
+
+        plan.transform(work);
+
+        out[0] = work[0] * work[0];
+
+        for (size_t k = 1; k < bins(); k++)
+        {
+            const double re = work[(2 * k) - 1];
+            const double im = ((2 * k) < N) ? work[2 * k] : 0.0;
+
+            out[k] = (re * re) + (im * im);
+        }
+    }
+
+
+}   /* namespace mlx */
@@ -0,0 +1,130 @@
+/**
+ * @file    mlx-welch.h
+ * @brief   Power Spectral Density by Welch's Method
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+
+#include "mlx-fft-plan-cache.h"
+#include "mlx-thread-pool.h"
+#include "mlx-window-function.h"
+
+
+namespace mlx
+{
+
+    typedef enum {
+        MLX_DETREND_NONE = 1,
+        MLX_DETREND_CONSTANT = 2,       // remove Mean per Segment
+        MLX_DETREND_LINEAR = 3,         // remove least-squares Line per Segment
+    } DetrendType_t;
+
+
+    typedef enum {
+        MLX_AVERAGE_MEAN = 1,
+        MLX_AVERAGE_MEDIAN = 2,         // bias-corrected, robust against Transients
+    } AverageType_t;
+
+
+    /**
+     * @brief   Averaged, windowed Periodograms of overlapping Segments
+     *
+     *  Same Estimate as scipy.signal.welch(..., scaling='density'): one-sided PSD in
+     *  Units^2 / Hz. Segments are distributed over the Thread Pool, each Worker uses
+     *  its thread-local Plan from the Plan Cache. Mean Averaging keeps one Partial Sum
+     *  per Worker, Median Averaging keeps all Periodograms.
+     */
+    class MlxWelchPSD
+    {
+    public:
+
+        /**
+         * @brief   Create Estimator
+         *
+         * @param segmentLength     Samples per Segment (FFT Length)
+         * @param overlap           Samples shared by consecutive Segments (< segmentLength)
+         * @param window            Window Function
+         * @param detrend           Detrending per Segment
+         * @param average           Averaging of the Periodograms
+         * @param pool              Worker Threads
+         */
+        MlxWelchPSD(size_t segmentLength, size_t overlap, WindowType_t window = MLX_WINDOW_HANN,
+            DetrendType_t detrend = MLX_DETREND_CONSTANT, AverageType_t average = MLX_AVERAGE_MEAN,
+            MlxThreadPool &pool = MlxThreadPool::global());
+
+        ~MlxWelchPSD();
+
+
+        size_t segmentLength() const;
+        size_t overlap() const;
+
+        /**
+         * @brief   PSD Values (DC ... Nyquist)
+         */
+        size_t bins() const;
+
+        /**
+         * @brief   Number of Segments in n Samples (trailing Samples are not used)
+         */
+        size_t segments(size_t n) const;
+
+
+        /**
+         * @brief   Estimate PSD
+         *
+         * @param in    Samples
+         * @param n     Number of Samples (at least segmentLength())
+         * @param fs    Sample Frequency
+         * @param psd   bins() Values
+         * @return      false if n is shorter than one Segment
+         */
+        bool compute(const double *in, size_t n, double fs, double *psd);
+
+        /**
+         * @brief   Estimate PSD and integrate into Bands of Width df (see integrateSpectralBands)
+         *
+         * @param in    Samples
+         * @param n     Number of Samples
+         * @param fs    Sample Frequency
+         * @param df    Band Width in Hz
+         * @param bands spectralBandCount(bins(), fs / segmentLength(), df) Band Powers (Units^2)
+         * @return      false if n is shorter than one Segment or df <= 0
+         */
+        bool computeBands(const double *in, size_t n, double fs, double df, double *bands);
+
+
+    protected:
+
+        void _periodogram(const double *segment, double *work, MlxMixedRadixRealFFT &plan, double *out) const;
+
+        const size_t _length;
+        const size_t _overlap;
+        const DetrendType_t _detrend;
+        const AverageType_t _average;
+        MlxThreadPool &_pool;
+
+        std::vector<double> _window;
+        double _windowPower;
+
+        // Averaged PSD (for Band Integration) and Periodograms / Partial Sums
+        std::vector<double> _psd;
+        std::vector<double> _stack;
+
+
+    };  /* MlxWelchPSD */
+
+
+}   /* namespace mlx */
@@ -0,0 +1,87 @@
+/**
+ * @file    mlx-window-function.cc
+ * @brief   Window Functions for spectral Analysis
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-window-function.h"
+
+#include <math.h>
+
+
+namespace mlx
+{
+
+    /* Sum of Cosines a[0] - a[1] cos(x) + a[2] cos(2x) - ... over a symmetric Window of M Points */
+    static void _generalCosine(const double *a, size_t terms, size_t M, std::vector<double> &w)
+    {
+        for (size_t n = 0; n < w.size(); n++)
+        {
+            const double x = (2.0 * M_PI * n) / (M - 1);
+            double val = 0.0;
+            double sign = 1.0;
+
+            for (size_t k = 0; k < terms; k++)
+            {
+                val += sign * a[k] * cos(k * x);
+                sign = -sign;
+            }
+
+            w[n] = val;
+        }
+    }
+
+
+    std::vector<double> windowFunction(WindowType_t type, size_t length, bool periodic)
+    {
+        std::vector<double> w(length, 1.0);
+        if (length <= 1) return w;
+
+        // Periodic Windows are the first length Points of a symmetric Window of length + 1
+        const size_t M = periodic ? (length + 1) : length;
+
+        static const double hann[] = { 0.5, 0.5 };
+        static const double hamming[] = { 0.54, 0.46 };
+        static const double blackman[] = { 0.42, 0.5, 0.08 };
+        static const double flattop[] = { 0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368 };
+
+        switch (type)
+        {
+            case MLX_WINDOW_RECTANGULAR:
+                break;
+
+            case MLX_WINDOW_HANN:
+                _generalCosine(hann, 2, M, w);
+                break;
+
+            case MLX_WINDOW_HAMMING:
+                _generalCosine(hamming, 2, M, w);
+                break;
+
+            case MLX_WINDOW_BLACKMAN:
+                _generalCosine(blackman, 3, M, w);
+                break;
+
+            case MLX_WINDOW_FLATTOP:
+                _generalCosine(flattop, 5, M, w);
+                break;
+
+            default:
+                w.clear();
+                break;
+        }
+
+        return w;
+    }
+
+
+}   /* namespace mlx */
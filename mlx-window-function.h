@@ -0,0 +1,49 @@
+/**
+ * @file    mlx-window-function.h
+ * @brief   Window Functions for spectral Analysis
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+
+namespace mlx
+{
+
+    typedef enum {
+        MLX_WINDOW_RECTANGULAR = 1,
+        MLX_WINDOW_HANN = 2,
+        MLX_WINDOW_HAMMING = 3,
+        MLX_WINDOW_BLACKMAN = 4,
+        MLX_WINDOW_FLATTOP = 5,
+    } WindowType_t;
+
+
+    /**
+     * @brief   Window Coefficients
+     *
+     *  Periodic Windows (as scipy.signal.get_window with fftbins=True) are meant for
+     *  FFT Frames, symmetric ones for FIR Design.
+     *
+     * @param type      Window Function
+     * @param length    Number of Coefficients
+     * @param periodic  Periodic (length + 1 symmetric, last dropped) or symmetric Window
+     * @return          Coefficients, empty for unknown Type
+     */
+    std::vector<double> windowFunction(WindowType_t type, size_t length, bool periodic = true);
+
+
+}   /* namespace mlx */
@@ -0,0 +1,267 @@
+/**
+ * @file    mlx-zoom-fft.cc
+ * @brief   Chirp-Z Zoom Transform for narrow Frequency Bands
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "mlx-zoom-fft.h"
+
+#include <math.h>
+#include <algorithm>
+
+
+namespace mlx
+{
+
+    namespace
+    {
+        /* exp(-2 pi i c) for a Phase c in Cycles; the Fraction is taken in long double (n^2 grows fast) */
+        inline void _mlx_cycles(long double c, double &re, double &im)
+        {
+            const long double frac = c - floorl(c);
+            const double a = double(2.0L * M_PIl * frac);
+
+            re = cos(a);
+            im = -sin(a);
+        }
+    }
+
+
+    MlxZoomFFT::MlxZoomFFT(size_t length, double fs, double f0, double f1, size_t bins, MlxFFTPlanCache &cache)
+    : _length(length)
+    , _bins(bins)
+    , _fs(fs)
+    , _f0(f0)
+    , _df((bins > 1) ? ((f1 - f0) / (bins - 1)) : 0.0)
+    , _fftLength(0)
+    , _cache(cache)
+    {
+        if ((_length == 0) || (_bins == 0) || (_fs <= 0.0)) return;
+
+        _fftLength = MLX_FFT_NATIVE_MIN_LENGTH;
+        while (_fftLength < (_length + _bins - 1)) _fftLength *= 2;
+
+        const size_t L = _fftLength;
+        const long double r0 = (long double)_f0 / _fs;
+        const long double r = (long double)_df / _fs;
+
+        _ar.resize(_length);
+        _ai.resize(_length);
+        for (size_t n = 0; n < _length; n++)
+        {
+            const long double nn = (long double)n;
+            _mlx_cycles((r0 * nn) + (0.5L * r * nn * nn), _ar[n], _ai[n]);
+        }
+
+        _pr.resize(_bins);
+        _pi.resize(_bins);
+        for (size_t k = 0; k < _bins; k++)
+        {
+            const long double kk = (long double)k;
+            _mlx_cycles(0.5L * r * kk * kk, _pr[k], _pi[k]);
+        }
+
+        _yr.assign(L, 0.0);
+        _yi.assign(L, 0.0);
+        _zr.resize(L);
+        _zi.resize(L);
+
+        // h[m] = exp(+i phi m^2 / 2) at m mod L; Indices in between stay zero
+        for (size_t m = 0; m < _bins; m++)
+        {
+            const long double mm = (long double)m;
+            _mlx_cycles(-0.5L * r * mm * mm, _yr[m], _yi[m]);
+        }
+
+        for (size_t m = 1; m < _length; m++)
+        {
+            const long double mm = (long double)m;
+            _mlx_cycles(-0.5L * r * mm * mm, _yr[L - m], _yi[L - m]);
+        }
+
+        std::shared_ptr<MlxMixedRadixRealFFT> plan = _cache.acquire(L);
+
+        _br.resize(L);
+        _bi.resize(L);
+
+        if (plan && _forward(*plan, _yr.data(), _yi.data()))
+        {
+            _br = _zr;
+            _bi = _zi;
+        }
+        else
+        {
+            _fftLength = 0;
+        }
+    }
+
+
+    MlxZoomFFT::~MlxZoomFFT()
+    {
+    }
+
+
+    size_t MlxZoomFFT::length() const
+    {
+        return _length;
+    }
+
+
+    size_t MlxZoomFFT::bins() const
+    {
+        return _bins;
+    }
+
+
+    size_t MlxZoomFFT::fftLength() const
+    {
+        return _fftLength;
+    }
+
+
+    double MlxZoomFFT::frequency(size_t k) const
+    {
+        return _f0 + (k * _df);
+    }
+
+
+    bool MlxZoomFFT::transform(const double *in, MlxComplexVector &out)
+    {
+        if (!_convolve(in)) return false;
+
+        out.resize(_bins);
+
+        for (size_t k = 0; k < _bins; k++)
+        {
+            const double gr = _yr[k];
+            const double gi = _yi[k];
+
+            out.set(k, std::complex<double>((gr * _pr[k]) - (gi * _pi[k]), (gr * _pi[k]) + (gi * _pr[k])));
+        }
+
+        return true;
+    }
+
+
+    bool MlxZoomFFT::magnitude(const double *in, double *out)
+    {
+        if (!_convolve(in)) return false;
+
+        // |Post-Chirp| = 1
+        const double factor = 2.0 / _length;
+
+        for (size_t k = 0; k < _bins; k++)
+        {
+            out[k] = factor * sqrt((_yr[k] * _yr[k]) + (_yi[k] * _yi[k]));
+        }
+
+        return true;
+    }
+
+
+    /* g = IFFT(FFT(x a) B), Result in (_yr, _yi) */
+    bool MlxZoomFFT::_convolve(const double *in)
+    {
+        const size_t L = _fftLength;
+        if (L == 0) return false;
+
+        std::shared_ptr<MlxMixedRadixRealFFT> plan = _cache.acquire(L);
+        if (!plan) return false;
+
+        for (size_t n = 0; n < _length; n++)
+        {
+            _yr[n] = in[n] * _ar[n];
+            _yi[n] = in[n] * _ai[n];
+        }
+
+        std::fill(_yr.begin() + _length, _yr.end(), 0.0);
+        std::fill(_yi.begin() + _length, _yi.end(), 0.0);
+
+        if (!_forward(*plan, _yr.data(), _yi.data())) return false;
+
+        for (size_t k = 0; k < L; k++)
+        {
+            const double re = (_zr[k] * _br[k]) - (_zi[k] * _bi[k]);
+            const double im = (_zr[k] * _bi[k]) + (_zi[k] * _br[k]);
+
+            _zr[k] = re;
+            _zi[k] = im;
+        }
+
+        return _inverse(*plan, _zr.data(), _zi.data());
+    }
+
+
+    /*
+     *  Complex Forward Transform of (re, im) with two real Transforms: Y = R + i I,
+     *  R, I Hermitian. re / im are overwritten, the Spectrum is put into (_zr, _zi).
+     */
+    bool MlxZoomFFT::_forward(MlxMixedRadixRealFFT &plan, double *re, double *im)
+    {
+        const size_t L = _fftLength;
+
+        if (!plan.transform(re) || !plan.transform(im)) return false;
+
+        _zr[0] = re[0];
+        _zi[0] = im[0];
+
+        for (size_t k = 1; k < (L / 2); k++)
+        {
+            const double rr = re[(2 * k) - 1], ri = re[2 * k];
+            const double ir = im[(2 * k) - 1], ii = im[2 * k];
+
+            _zr[k] = rr - ii;
+            _zi[k] = ri + ir;
+            _zr[L - k] = rr + ii;
+            _zi[L - k] = ir - ri;
+        }
+
+        _zr[L / 2] = re[L - 1];
+        _zi[L / 2] = im[L - 1];
+
+        return true;
+    }
+
+
+    /*
+     *  Complex Inverse of the Spectrum (re, im) with two real Transforms: G = P + i Q with
+     *  P = (G[k] + G*[L-k]) / 2 and Q = (G[k] - G*[L-k]) / 2i Hermitian.
+     *  Result into (_yr, _yi).
+     */
+    bool MlxZoomFFT::_inverse(MlxMixedRadixRealFFT &plan, double *re, double *im)
+    {
+        const size_t L = _fftLength;
+        double *p = _yr.data();
+        double *q = _yi.data();
+
+        p[0] = re[0];
+        q[0] = im[0];
+
+        for (size_t k = 1; k < (L / 2); k++)
+        {
+            const double ar = re[k], ai = im[k];
+            const double cr = re[L - k], ci = im[L - k];
+
+            p[(2 * k) - 1] = 0.5 * (ar + cr);
+            p[2 * k] = 0.5 * (ai - ci);
+            q[(2 * k) - 1] = 0.5 * (ai + ci);
+            q[2 * k] = -0.5 * (ar - cr);
+        }
+
+        p[L - 1] = re[L / 2];
+        q[L - 1] = im[L / 2];
+
+        return plan.inverse(p) && plan.inverse(q);
+    }
+
+
+}   /* namespace mlx */
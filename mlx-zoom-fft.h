@@ -0,0 +1,126 @@
+/**
+ * @file    mlx-zoom-fft.h
+ * @brief   Chirp-Z Zoom Transform for narrow Frequency Bands
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include "structures/mlx-vector.h"
+#include "mlx-fft-plan-cache.h"
+
+
+namespace mlx
+{
+
+    /**
+     * @brief   Spectrum of N Samples at M equally spaced Frequencies in [f0, f1]
+     *
+     *  Bluestein's Chirp-Z Algorithm: with nk = (n^2 + k^2 - (k - n)^2) / 2 the DFT at
+     *  the zoomed Frequencies becomes a Convolution with a Chirp, evaluated with FFTs of
+     *  a Power of Two L >= N + M - 1, so the Cost is O((N + M) log(N + M)) instead of a
+     *  zero-padded FFT to fs / df Points. Result equals the padded FFT where the Grids meet.
+     *
+     *  The complex L-Point Transforms run as Pairs of real Transforms on the Plans of
+     *  MlxFFTPlanCache. Chirps and the Chirp Spectrum are computed once per Instance.
+     *  An Instance must not be used by two Threads at once.
+     */
+    class MlxZoomFFT
+    {
+    public:
+
+        /**
+         * @brief   Create Zoom Transform
+         *
+         * @param length    Number of Samples N
+         * @param fs        Sample Frequency
+         * @param f0        first Frequency
+         * @param f1        last Frequency (may be below f0)
+         * @param bins      Number of Frequencies M
+         * @param cache     Plan Cache for the L-Point Transforms
+         */
+        MlxZoomFFT(size_t length, double fs, double f0, double f1, size_t bins, MlxFFTPlanCache &cache = MlxFFTPlanCache::global());
+        ~MlxZoomFFT();
+
+
+        size_t length() const;
+        size_t bins() const;
+
+        /**
+         * @brief   Convolution (FFT) Length L
+         */
+        size_t fftLength() const;
+
+        double frequency(size_t k) const;
+
+
+        /**
+         * @brief   X[k] = sum_n x[n] exp(-2 pi i f_k n / fs), unscaled as an FFT Bin
+         *
+         * @param in    length() Samples
+         * @param out   resized to bins() Values, Layout is kept
+         * @return      false on Error
+         */
+        bool transform(const double *in, MlxComplexVector &out);
+
+        /**
+         * @brief   2 / N |X[k]| (Scaling of MlxMixedRadixRealFFT::normalizedMagnitude)
+         *
+         * @param in    length() Samples
+         * @param out   bins() Values
+         * @return      false on Error
+         */
+        bool magnitude(const double *in, double *out);
+
+
+    protected:
+
+        bool _convolve(const double *in);
+        bool _forward(MlxMixedRadixRealFFT &plan, double *re, double *im);
+        bool _inverse(MlxMixedRadixRealFFT &plan, double *re, double *im);
+
+        const size_t _length;
+        const size_t _bins;
+        const double _fs;
+        const double _f0;
+        const double _df;
+        size_t _fftLength;
+
+        MlxFFTPlanCache &_cache;
+
+        // Pre-Chirp exp(-i (2 pi f0 n / fs + phi n^2 / 2)), phi = 2 pi df / fs
+        std::vector<double> _ar;
+        std::vector<double> _ai;
+
+        // Post-Chirp exp(-i phi k^2 / 2)
+        std::vector<double> _pr;
+        std::vector<double> _pi;
+
+        // Spectrum of the circular Chirp exp(+i phi m^2 / 2), m = -(N - 1) ... M - 1
+        std::vector<double> _br;
+        std::vector<double> _bi;
+
+        // Half Complex (y) and full complex (z) Buffers, L Values each
+        std::vector<double> _yr;
+        std::vector<double> _yi;
+        std::vector<double> _zr;
+        std::vector<double> _zi;
+
+
+    };  /* MlxZoomFFT */
+
+
+}   /* namespace mlx */
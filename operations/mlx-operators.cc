@@ -1,15 +1,336 @@
-
+/**
+ * @file    mlx-operators.cc
+ * @brief   Convolution and Correlation (direct and FFT Overlap-Save)
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
 
 #include "mlx-operators.h"
+#include "../mlx-cpu-features.h"
+
+#include <math.h>
+#include <algorithm>
+
 
 namespace mlx
 {
 
-MlxFixedVector<double> convolve(const MlxFixedVector<double> &win)
-{
+    namespace
+    {
+        /* Range of the full Output covered by a Mode */
+        void _mlx_convolve_range(size_t n, size_t m, ConvolveMode_t mode, size_t &start, size_t &len)
+        {
+            switch (mode)
+            {
+                case MLX_CONVOLVE_SAME:
+                    start = (m - 1) / 2;
+                    len = n;
+                    break;
+
+                case MLX_CONVOLVE_VALID:
+                    start = std::min(n, m) - 1;
+                    len = std::max(n, m) - std::min(n, m) + 1;
+                    break;
+
+                default:
+                    start = 0;
+                    len = n + m - 1;
+                    break;
+            }
+        }
+
+
+        /* Overlap-Save Block Length with the lowest Cost per Output, at most covering len + m - 1 */
+        size_t _mlx_convolve_block_length(size_t m, size_t len)
+        {
+            size_t L = 4;
+            while (L < (m + 1)) L *= 2;
+
+            size_t best = L;
+            double bestCost = HUGE_VAL;
+
+            for (size_t p = 0; p < 8; p++, L *= 2)
+            {
+                const double cost = (MLX_CONVOLVE_FFT_WEIGHT * L * log2(double(L))) / (2.0 * (L - m + 1));
+
+                if (cost < bestCost)
+                {
+                    best = L;
+                    bestCost = cost;
+                }
+
+                if (L >= (len + m - 1)) break;
+            }
+
+            return best;
+        }
+
+
+        /* acc[i] = sum_j h[j] src[i + j], Kernel-outer, 4 Taps per Pass */
+        inline __attribute__((always_inline))
+        void _mlx_convolve_block(const double *src, const double *h, size_t m, double *out, size_t len)
+        {
+            double acc[MLX_CONVOLVE_DIRECT_BLOCK];
+            std::fill(acc, acc + len, 0.0);
+
+            size_t j = 0;
+            for (; (j + 4) <= m; j += 4)
+            {
+                const double h0 = h[j], h1 = h[j + 1], h2 = h[j + 2], h3 = h[j + 3];
+                const double *s = src + j;
+
+                for (size_t i = 0; i < len; i++)
+                {
+                    acc[i] += (h0 * s[i]) + (h1 * s[i + 1]) + (h2 * s[i + 2]) + (h3 * s[i + 3]);
+                }
+            }
+
+            for (; j < m; j++)
+            {
+                const double hj = h[j];
+                const double *s = src + j;
+
+                for (size_t i = 0; i < len; i++) acc[i] += hj * s[i];
+            }
+
+            std::copy(acc, acc + len, out);
+        }
+
+
+#ifdef MLX_X86_DISPATCH
+        __attribute__((target("avx2,fma")))
+        void _mlx_convolve_block_avx2(const double *src, const double *h, size_t m, double *out, size_t len)
+        {
+            _mlx_convolve_block(src, h, m, out, len);
+        }
+#endif
+    }
+
+
+
+    size_t convolveLength(size_t n, size_t m, ConvolveMode_t mode)
+    {
+        if ((n == 0) || (m == 0)) return 0;
+
+        size_t start, len;
+        _mlx_convolve_range(n, m, mode, start, len);
+
+        return len;
+    }
+
+
+    ConvolveMethod_t convolveMethod(size_t n, size_t m, ConvolveMode_t mode)
+    {
+        if ((n == 0) || (m == 0)) return MLX_CONVOLVE_DIRECT;
+
+        size_t start, len;
+        _mlx_convolve_range(n, m, mode, start, len);
+
+        const size_t L = _mlx_convolve_block_length(m, len);
+        const size_t S = L - m + 1;
+        const double pairs = ceil(ceil(double(len) / S) / 2.0);
+
+        // Kernel Spectrum counts as half a Pair
+        const double fft = (pairs + 0.5) * MLX_CONVOLVE_FFT_WEIGHT * L * log2(double(L));
+        const double direct = double(len) * m;
+
+        return (fft < direct) ? MLX_CONVOLVE_FFT : MLX_CONVOLVE_DIRECT;
+    }
+
+
+
+/// Start - MlxConvolver
+
+
+    MlxConvolver::MlxConvolver(const double *kernel, size_t m, bool correlate)
+    : _kernel(kernel, kernel + m)
+    , _reversed(kernel, kernel + m)
+    , _blockLength(0)
+    , _avx2(mlxCpuHasAvx2Fma())
+    {
+        // Correlation is Convolution with the reversed Kernel
+        if (correlate) std::reverse(_kernel.begin(), _kernel.end());
+        else std::reverse(_reversed.begin(), _reversed.end());
+    }
+
+
+    MlxConvolver::~MlxConvolver()
+    {
+    }
+
+
+    size_t MlxConvolver::kernelLength() const
+    {
+        return _kernel.size();
+    }
+
+
+    size_t MlxConvolver::outputLength(size_t n, ConvolveMode_t mode) const
+    {
+        return convolveLength(n, _kernel.size(), mode);
+    }
+
+
+    bool MlxConvolver::apply(const double *in, size_t n, double *out, ConvolveMode_t mode, ConvolveMethod_t method)
+    {
+        const size_t m = _kernel.size();
+        if ((n == 0) || (m == 0)) return false;
+
+        size_t start, len;
+        _mlx_convolve_range(n, m, mode, start, len);
+
+        if (method == MLX_CONVOLVE_AUTO) method = convolveMethod(n, m, mode);
+
+        if (method == MLX_CONVOLVE_FFT) _overlapSave(in, n, out, start, len);
+        else _direct(in, n, out, start, len);
+
+        return true;
+    }
+
+
+    /* full[i] = sum_j reversed[j] padded[i + j], padded = m - 1 Zeros | Signal | m - 1 Zeros */
+    void MlxConvolver::_direct(const double *in, size_t n, double *out, size_t start, size_t len)
+    {
+        const size_t m = _kernel.size();
+
+        _padded.assign(n + (2 * (m - 1)), 0.0);
+        std::copy(in, in + n, _padded.begin() + (m - 1));
+
+        for (size_t i0 = 0; i0 < len; i0 += MLX_CONVOLVE_DIRECT_BLOCK)
+        {
+            const size_t blk = std::min(MLX_CONVOLVE_DIRECT_BLOCK, len - i0);
+            const double *src = _padded.data() + start + i0;
+
+#ifdef MLX_X86_DISPATCH
+            if (_avx2)
+            {
+                _mlx_convolve_block_avx2(src, _reversed.data(), m, out + i0, blk);
+            }
+            else
+#endif
+            {
+                _mlx_convolve_block(src, _reversed.data(), m, out + i0, blk);
+            }
+        }
+    }
+
+
+    /*
+     *  Block of L padded Samples starting at Output i0: circular Convolution with the
+     *  Kernel is exact for Positions m - 1 ... L - 1 (Outputs i0 ... i0 + L - m).
+     *  Kernel is real, so two Blocks are transformed at once as Real / imaginary Part.
+     */
+    void MlxConvolver::_overlapSave(const double *in, size_t n, double *out, size_t start, size_t len)
+    {
+        const size_t m = _kernel.size();
+
+        _prepareFFT(_mlx_convolve_block_length(m, len));
+
+        const size_t L = _blockLength;
+        const size_t S = L - m + 1;
+
+        double *zr = _zr.data();
+        double *zi = _zi.data();
+
+        // padded[k] = Signal[k - (m - 1)], zero outside
+        auto load = [&](double *dst, size_t first)
+        {
+            for (size_t p = 0; p < L; p++)
+            {
+                const size_t k = first + p;
+                dst[p] = ((k >= (m - 1)) && ((k - (m - 1)) < n)) ? in[k - (m - 1)] : 0.0;
+            }
+        };
+
+        for (size_t i0 = 0; i0 < len; i0 += 2 * S)
+        {
+            const size_t lenA = std::min(S, len - i0);
+            const size_t lenB = ((i0 + S) < len) ? std::min(S, len - (i0 + S)) : 0;
+
+            load(zr, start + i0);
+            if (lenB > 0) load(zi, start + i0 + S);
+            else std::fill(zi, zi + L, 0.0);
+
+            _fft->forward(zr, zi);
+
+            for (size_t k = 0; k < L; k++)
+            {
+                const double re = (zr[k] * _hr[k]) - (zi[k] * _hi[k]);
+                const double im = (zr[k] * _hi[k]) + (zi[k] * _hr[k]);
+
+                zr[k] = re;
+                zi[k] = im;
+            }
+
+            _fft->inverse(zr, zi);
+
+            std::copy(zr + (m - 1), zr + (m - 1) + lenA, out + i0);
+            if (lenB > 0) std::copy(zi + (m - 1), zi + (m - 1) + lenB, out + i0 + S);
+        }
+    }
+
+
+    void MlxConvolver::_prepareFFT(size_t L)
+    {
+        if (L == _blockLength) return;
+
+        _blockLength = L;
+        _fft = std::make_unique<MlxComplexFFT>(L);
+
+        _hr.assign(L, 0.0);
+        _hi.assign(L, 0.0);
+        std::copy(_kernel.begin(), _kernel.end(), _hr.begin());
+        _fft->forward(_hr.data(), _hi.data());
+
+        _zr.resize(L);
+        _zi.resize(L);
+    }
+
+
+/// END - MlxConvolver
+
+
+
+    bool convolve(const double *signal, size_t n, const double *kernel, size_t m, double *out, ConvolveMode_t mode, ConvolveMethod_t method)
+    {
+        MlxConvolver conv(kernel, m);
+        return conv.apply(signal, n, out, mode, method);
+    }
+
+
+    bool correlate(const double *signal, size_t n, const double *kernel, size_t m, double *out, ConvolveMode_t mode, ConvolveMethod_t method)
+    {
+        MlxConvolver conv(kernel, m, true);
+        return conv.apply(signal, n, out, mode, method);
+    }
+
+
+    MlxFixedVector<double> convolve(MlxFixedVector<double> &signal, MlxFixedVector<double> &kernel, ConvolveMode_t mode)
+    {
+        MlxFixedVector<double> res(convolveLength(signal.size(), kernel.size(), mode));
+        if (res.size() == 0) return res;
+
+        convolve(&signal[0], signal.size(), &kernel[0], kernel.size(), &res[0], mode);
+        return res;
+    }
+
+
+    MlxFixedVector<double> correlate(MlxFixedVector<double> &signal, MlxFixedVector<double> &kernel, ConvolveMode_t mode)
+    {
+        MlxFixedVector<double> res(convolveLength(signal.size(), kernel.size(), mode));
+        if (res.size() == 0) return res;
 
-    return MlxFixedVector<double>(1);
-}
+        correlate(&signal[0], signal.size(), &kernel[0], kernel.size(), &res[0], mode);
+        return res;
+    }
 
 
-}   /* namespace mlx */
\ No newline at end of file
+}   /* namespace mlx */
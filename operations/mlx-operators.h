@@ -1,12 +1,167 @@
+/**
+ * @file    mlx-operators.h
+ * @brief   Convolution and Correlation (direct and FFT Overlap-Save)
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
 
 
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+
 #include "../structures/mlx-vector.h"
+#include "../mlx-complex-fft.h"
+
 
 namespace mlx
 {
-    
-    MlxFixedVector<double> convolve(const MlxFixedVector<double> &win);
 
+    typedef enum {
+        MLX_CONVOLVE_FULL = 1,      // n + m - 1 Values
+        MLX_CONVOLVE_SAME = 2,      // n Values, centered on the full Output
+        MLX_CONVOLVE_VALID = 3,     // |n - m| + 1 Values without zero-padded Edges
+    } ConvolveMode_t;
+
+
+    typedef enum {
+        MLX_CONVOLVE_AUTO = 0,      // chosen by convolveMethod()
+        MLX_CONVOLVE_DIRECT = 1,
+        MLX_CONVOLVE_FFT = 2,
+    } ConvolveMethod_t;
+
+
+    /* Outputs per Block of the direct Kernel */
+    static const size_t MLX_CONVOLVE_DIRECT_BLOCK = 256;
+
+    /* Cost of one L log2(L) Unit of a complex FFT Pair (forward + inverse) in direct Multiply-Adds */
+    static const double MLX_CONVOLVE_FFT_WEIGHT = 4.5;
+
+
+    /**
+     * @brief   Number of Output Values
+     *
+     * @param n     Signal Length
+     * @param m     Kernel Length
+     * @param mode  Output Mode
+     */
+    size_t convolveLength(size_t n, size_t m, ConvolveMode_t mode);
+
+
+    /**
+     * @brief   Cost Model: direct for short Kernels, FFT Overlap-Save for long ones
+     *
+     *  Direct costs n_out m Multiply-Adds, Overlap-Save about
+     *  MLX_CONVOLVE_FFT_WEIGHT L log2(L) per two Blocks of L - m + 1 Outputs.
+     */
+    ConvolveMethod_t convolveMethod(size_t n, size_t m, ConvolveMode_t mode = MLX_CONVOLVE_FULL);
+
+
+    /**
+     * @brief   Convolution with a fixed Kernel
+     *
+     *  Keeps the (reversed) Kernel and, once the FFT Path is used, its Spectrum and
+     *  FFT Plan, so repeated Calls (Matched Filters) only transform the Signal.
+     *  Buffers are reused, an Instance must not be used by two Threads at once.
+     */
+    class MlxConvolver
+    {
+    public:
+
+        /**
+         * @brief   Create Convolver
+         *
+         * @param kernel        Kernel Values
+         * @param m             Kernel Length
+         * @param correlate     cross-correlate with the Kernel instead (Kernel is reversed)
+         */
+        MlxConvolver(const double *kernel, size_t m, bool correlate = false);
+        ~MlxConvolver();
+
+        MlxConvolver(const MlxConvolver&) = delete;
+        void operator= (const MlxConvolver&) = delete;
+
+
+        size_t kernelLength() const;
+
+        size_t outputLength(size_t n, ConvolveMode_t mode) const;
+
+
+        /**
+         * @brief   Convolve a Signal
+         *
+         * @param in        Signal
+         * @param n         Signal Length
+         * @param out       outputLength(n, mode) Values
+         * @param mode      Output Mode
+         * @param method    Path, AUTO uses the Cost Model
+         * @return          false for empty Signal or Kernel
+         */
+        bool apply(const double *in, size_t n, double *out, ConvolveMode_t mode = MLX_CONVOLVE_FULL, ConvolveMethod_t method = MLX_CONVOLVE_AUTO);
+
+
+    protected:
+
+        void _direct(const double *in, size_t n, double *out, size_t start, size_t len);
+        void _overlapSave(const double *in, size_t n, double *out, size_t start, size_t len);
+        void _prepareFFT(size_t L);
+
+        // Kernel Values in Convolution Order and reversed (direct Path)
+        std::vector<double> _kernel;
+        std::vector<double> _reversed;
+
+        // Zero-padded Signal of the direct Path
+        std::vector<double> _padded;
+
+        // Overlap-Save: Block Length, split Kernel Spectrum and Block Buffers
+        size_t _blockLength;
+        std::unique_ptr<MlxComplexFFT> _fft;
+        std::vector<double> _hr;
+        std::vector<double> _hi;
+        std::vector<double> _zr;
+        std::vector<double> _zi;
+
+        bool _avx2;
+
+
+    };  /* MlxConvolver */
+
+
+    /**
+     * @brief   Convolve Signal with Kernel
+     *
+     * @param signal    Signal
+     * @param n         Signal Length
+     * @param kernel    Kernel
+     * @param m         Kernel Length
+     * @param out       convolveLength(n, m, mode) Values
+     * @param mode      Output Mode
+     * @param method    Path, AUTO uses the Cost Model
+     * @return          false for empty Signal or Kernel
+     */
+    bool convolve(const double *signal, size_t n, const double *kernel, size_t m, double *out,
+                  ConvolveMode_t mode = MLX_CONVOLVE_FULL, ConvolveMethod_t method = MLX_CONVOLVE_AUTO);
+
+    /**
+     * @brief   Cross-Correlation c[k] = sum x[i + k] h[i] in the Layout of convolve() with the reversed Kernel
+     */
+    bool correlate(const double *signal, size_t n, const double *kernel, size_t m, double *out,
+                   ConvolveMode_t mode = MLX_CONVOLVE_FULL, ConvolveMethod_t method = MLX_CONVOLVE_AUTO);
+
+
+    MlxFixedVector<double> convolve(MlxFixedVector<double> &signal, MlxFixedVector<double> &kernel, ConvolveMode_t mode = MLX_CONVOLVE_FULL);
+
+    MlxFixedVector<double> correlate(MlxFixedVector<double> &signal, MlxFixedVector<double> &kernel, ConvolveMode_t mode = MLX_CONVOLVE_FULL);
 
 
-}   /* namespace mlx */
\ No newline at end of file
+}   /* namespace mlx */
@@ -0,0 +1,123 @@
+/**
+ * @file    mlx-matrix.h
+ * @brief   Dense row-major Matrix
+ *
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @author  M. Anschuetz (marbuntu)
+ *
+ *
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+
+namespace mlx
+{
+
+    /**
+     * @brief   Contiguous rows x cols Matrix, Row r starts at data() + r * cols()
+     *
+     *  Used for Batches of equal-length Frames and their Spectra.
+     */
+    template <
+        typename T,
+        typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type
+    >
+    class MlxFixedMatrix
+    {
+    public:
+
+        MlxFixedMatrix(size_t rows, size_t cols)
+        : _rows(rows)
+        , _cols(cols)
+        , _data(rows * cols, T(0))
+        {
+        }
+
+
+        MlxFixedMatrix(size_t rows, size_t cols, const T *data)
+        : _rows(rows)
+        , _cols(cols)
+        , _data(data, data + (rows * cols))
+        {
+        }
+
+
+        virtual ~MlxFixedMatrix() {};
+
+
+        size_t rows() const
+        {
+            return _rows;
+        }
+
+
+        size_t cols() const
+        {
+            return _cols;
+        }
+
+
+        T* data()
+        {
+            return _data.data();
+        }
+
+
+        const T* data() const
+        {
+            return _data.data();
+        }
+
+
+        T* row(size_t r)
+        {
+            return _data.data() + (r * _cols);
+        }
+
+
+        const T* row(size_t r) const
+        {
+            return _data.data() + (r * _cols);
+        }
+
+
+        T& operator() (size_t r, size_t c)
+        {
+            return _data[(r * _cols) + c];
+        }
+
+
+        T operator() (size_t r, size_t c) const
+        {
+            return _data[(r * _cols) + c];
+        }
+
+
+        void fill(T value)
+        {
+            std::fill(_data.begin(), _data.end(), value);
+        }
+
+
+    protected:
+
+        size_t _rows;
+        size_t _cols;
+        std::vector<T> _data;
+
+
+    };  /* MlxFixedMatrix */
+
+
+}   /* namespace mlx */
@@ -113,6 +113,249 @@ namespace mlx
 
 
 
+/// Start - MlxComplexVector
+
+
+    MlxComplexVector::MlxComplexVector()
+    : _length(0)
+    , _layout(MLX_COMPLEX_SPLIT)
+    {
+    }
+
+
+    MlxComplexVector::MlxComplexVector(size_t length, ComplexLayout_t layout)
+    : _data(2 * length, 0.0)
+    , _length(length)
+    , _layout(layout)
+    {
+    }
+
+
+    MlxComplexVector::MlxComplexVector(const std::vector<double> real, const std::vector<double> imag)
+    : _data(2 * real.size(), 0.0)
+    , _length(real.size())
+    , _layout(MLX_COMPLEX_SPLIT)
+    {
+        std::copy(real.begin(), real.end(), _data.begin());
+        std::copy(imag.begin(), imag.begin() + std::min(imag.size(), _length), _data.begin() + _length);
+    }
+
+
+    MlxComplexVector::MlxComplexVector(const std::vector<std::complex<double>> &values)
+    : _data(2 * values.size())
+    , _length(values.size())
+    , _layout(MLX_COMPLEX_INTERLEAVED)
+    {
+        std::copy(values.begin(), values.end(), complexData());
+    }
+
+
+    MlxComplexVector::MlxComplexVector(std::vector<double> &&buffer, ComplexLayout_t layout)
+    : _data(std::move(buffer))
+    , _length(_data.size() / 2)
+    , _layout(layout)
+    {
+        _data.resize(2 * _length);
+    }
+
+
+    MlxComplexVector::~MlxComplexVector()
+    {
+    }
+
+
+    size_t MlxComplexVector::size() const
+    {
+        return _length;
+    }
+
+
+    ComplexLayout_t MlxComplexVector::layout() const
+    {
+        return _layout;
+    }
+
+
+    std::complex<double> MlxComplexVector::at(size_t idx) const
+    {
+        if (idx >= _length) return std::complex<double>(0.0, 0.0);
+
+        if (_layout == MLX_COMPLEX_SPLIT) return std::complex<double>(_data[idx], _data[_length + idx]);
+        return std::complex<double>(_data[2 * idx], _data[(2 * idx) + 1]);
+    }
+
+
+    void MlxComplexVector::set(size_t idx, std::complex<double> value)
+    {
+        if (idx >= _length) return;
+
+        if (_layout == MLX_COMPLEX_SPLIT)
+        {
+            _data[idx] = value.real();
+            _data[_length + idx] = value.imag();
+        }
+        else
+        {
+            _data[2 * idx] = value.real();
+            _data[(2 * idx) + 1] = value.imag();
+        }
+    }
+
+
+    void MlxComplexVector::resize(size_t length)
+    {
+        if (length == _length) return;
+
+        _data.assign(2 * length, 0.0);
+        _length = length;
+    }
+
+
+    void MlxComplexVector::fill(std::complex<double> value)
+    {
+        for (size_t n = 0; n < _length; n++) set(n, value);
+    }
+
+
+    void MlxComplexVector::reset()
+    {
+        std::fill(_data.begin(), _data.end(), 0.0);
+    }
+
+
+    double *MlxComplexVector::data()
+    {
+        return _data.data();
+    }
+
+
+    const double *MlxComplexVector::data() const
+    {
+        return _data.data();
+    }
+
+
+    double *MlxComplexVector::real()
+    {
+        return (_layout == MLX_COMPLEX_SPLIT) ? _data.data() : nullptr;
+    }
+
+
+    double *MlxComplexVector::imag()
+    {
+        return (_layout == MLX_COMPLEX_SPLIT) ? (_data.data() + _length) : nullptr;
+    }
+
+
+    const double *MlxComplexVector::real() const
+    {
+        return (_layout == MLX_COMPLEX_SPLIT) ? _data.data() : nullptr;
+    }
+
+
+    const double *MlxComplexVector::imag() const
+    {
+        return (_layout == MLX_COMPLEX_SPLIT) ? (_data.data() + _length) : nullptr;
+    }
+
+
+    std::complex<double> *MlxComplexVector::complexData()
+    {
+        return (_layout == MLX_COMPLEX_INTERLEAVED) ? reinterpret_cast<std::complex<double>*>(_data.data()) : nullptr;
+    }
+
+
+    const std::complex<double> *MlxComplexVector::complexData() const
+    {
+        return (_layout == MLX_COMPLEX_INTERLEAVED) ? reinterpret_cast<const std::complex<double>*>(_data.data()) : nullptr;
+    }
+
+
+    void MlxComplexVector::setLayout(ComplexLayout_t layout)
+    {
+        if (layout == _layout) return;
+
+        std::vector<double> buf(2 * _length);
+
+        for (size_t n = 0; n < _length; n++)
+        {
+            if (layout == MLX_COMPLEX_SPLIT)
+            {
+                buf[n] = _data[2 * n];
+                buf[_length + n] = _data[(2 * n) + 1];
+            }
+            else
+            {
+                buf[2 * n] = _data[n];
+                buf[(2 * n) + 1] = _data[_length + n];
+            }
+        }
+
+        _data.swap(buf);
+        _layout = layout;
+    }
+
+
+    std::vector<double> MlxComplexVector::release()
+    {
+        std::vector<double> out;
+        out.swap(_data);
+        _length = 0;
+
+        return out;
+    }
+
+
+    std::vector<std::complex<double>> MlxComplexVector::toStdVector() const
+    {
+        std::vector<std::complex<double>> out(_length);
+
+        for (size_t n = 0; n < _length; n++) out[n] = at(n);
+
+        return out;
+    }
+
+
+    void MlxComplexVector::magnitude(double *out) const
+    {
+        if (_layout == MLX_COMPLEX_SPLIT)
+        {
+            const double *re = _data.data();
+            const double *im = _data.data() + _length;
+
+            for (size_t n = 0; n < _length; n++) out[n] = sqrt((re[n] * re[n]) + (im[n] * im[n]));
+        }
+        else
+        {
+            const double *d = _data.data();
+
+            for (size_t n = 0; n < _length; n++) out[n] = sqrt((d[2 * n] * d[2 * n]) + (d[(2 * n) + 1] * d[(2 * n) + 1]));
+        }
+    }
+
+
+    void MlxComplexVector::phase(double *out) const
+    {
+        if (_layout == MLX_COMPLEX_SPLIT)
+        {
+            const double *re = _data.data();
+            const double *im = _data.data() + _length;
+
+            for (size_t n = 0; n < _length; n++) out[n] = atan2(im[n], re[n]);
+        }
+        else
+        {
+            const double *d = _data.data();
+
+            for (size_t n = 0; n < _length; n++) out[n] = atan2(d[(2 * n) + 1], d[2 * n]);
+        }
+    }
+
+
+/// END - MlxComplexVector
+
+
+
 /// Start - MlxWindow
 
 
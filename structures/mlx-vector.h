@@ -21,6 +21,7 @@
 #include <memory>
 #include <algorithm>
 #include <functional>
+#include <complex>
 #include <math.h>
 #include <gsl/gsl_vector.h>
 
@@ -64,13 +65,115 @@ namespace mlx
 
     };  /* MlxVector */
 
+    typedef enum {
+        MLX_COMPLEX_INTERLEAVED = 1,    // re0, im0, re1, im1, ... (std::complex / GSL packed Array)
+        MLX_COMPLEX_SPLIT = 2,          // re0 ... reN-1, im0 ... imN-1
+    } ComplexLayout_t;
+
+
+    /**
+     * @brief   Complex Vector in one contiguous Buffer of 2 size() Values
+     *
+     *  The interleaved Layout can be handed to GSL and viewed as std::complex<double>,
+     *  the split Layout keeps Real and imaginary Parts in separate contiguous Halves,
+     *  so element-wise Kernels (Magnitude, Phase, Butterflies) vectorize.
+     *  Buffers can be adopted and released without Copy; only a Layout Change copies.
+     */
     class MlxComplexVector final
     {
     public:
         MlxComplexVector();
+        MlxComplexVector(size_t length, ComplexLayout_t layout = MLX_COMPLEX_SPLIT);
+
+        /**
+         * @brief   Split Vector from Real and imaginary Parts (imag may be empty)
+         */
         MlxComplexVector(const std::vector<double> real, const std::vector<double> imag);
 
+        /**
+         * @brief   Interleaved Vector from complex Values
+         */
+        MlxComplexVector(const std::vector<std::complex<double>> &values);
+
+        /**
+         * @brief   Adopt a Buffer of 2 N Values in the given Layout (no Copy)
+         */
+        MlxComplexVector(std::vector<double> &&buffer, ComplexLayout_t layout);
+
         ~MlxComplexVector();
+
+
+        size_t size() const;
+        ComplexLayout_t layout() const;
+
+        std::complex<double> at(size_t idx) const;
+        void set(size_t idx, std::complex<double> value);
+
+        /**
+         * @brief   Change Length, Contents are reset if the Length differs
+         */
+        void resize(size_t length);
+
+        void fill(std::complex<double> value);
+        void reset();
+
+
+        /**
+         * @brief   Raw Buffer, 2 size() Values in layout()
+         */
+        double *data();
+        const double *data() const;
+
+        /**
+         * @brief   Real / imaginary Parts of the split Layout, nullptr if interleaved
+         */
+        double *real();
+        double *imag();
+        const double *real() const;
+        const double *imag() const;
+
+        /**
+         * @brief   View of the interleaved Layout, nullptr if split
+         */
+        std::complex<double> *complexData();
+        const std::complex<double> *complexData() const;
+
+
+        /**
+         * @brief   Convert Layout (one Copy, no-op if already in layout)
+         */
+        void setLayout(ComplexLayout_t layout);
+
+        /**
+         * @brief   Hand out the Buffer (no Copy), the Vector is empty afterwards
+         */
+        std::vector<double> release();
+
+        std::vector<std::complex<double>> toStdVector() const;
+
+
+        /**
+         * @brief   |z| of every Element
+         *
+         * @param out   size() Values
+         */
+        void magnitude(double *out) const;
+
+        /**
+         * @brief   arg(z) of every Element in rad
+         *
+         * @param out   size() Values
+         */
+        void phase(double *out) const;
+
+
+    private:
+
+        std::vector<double> _data;
+        size_t _length;
+        ComplexLayout_t _layout;
+
+
     };  /* MlxComplexVector */
 
 
@@ -1,12 +1,17 @@
 
 
 
-
 #include "mlx-wvt-gauss.h"
+#include <stdlib.h>
 #include <string.h>
 
 
-static double mlx_default_gaussian_wavelet_alpha = 10.5;
+/* WaveletTemplate_t Values of the Gauss Families */
+#define MLX_WVT_GAUSS_FAMILY            1
+#define MLX_WVT_GAUSS_CENTERED_FAMILY   11
+
+
+static const double mlx_default_gaussian_wavelet_alpha = 10.5;
 
 
 void generate_gauss_wavelet(const double alpha, size_t N, gsl_vector **out)
@@ -16,34 +21,35 @@ void generate_gauss_wavelet(const double alpha, size_t N, gsl_vector **out)
 }
 
 
-gsl_wavelet* mlx_gauss_wavelet_allocate(const double alpha, size_t N_half)
+void mlx_gauss_wavelet_coefficients(const double alpha, size_t N, double sign, double *h, double *g)
 {
-    gsl_wavelet *wvt;
-    gsl_vector *vec;
-    size_t N = (N_half << 1);
-    generate_gauss_wavelet(alpha, N, &vec);
-
-    double *h = calloc(N, sizeof(double));
-    double *g = calloc(N, sizeof(double));
+    gsl_vector_view vec = gsl_vector_view_array(h, N);
+    gsl_filter_gaussian_kernel(alpha, 0, 1, &vec.vector);
 
-    //memcpy((void*) wvt->g1, &vec->data[0], N * sizeof(double));
-    //memcpy((void*) wvt->h1, &vec->data[N_half], N * sizeof(double));
+    for (size_t n = 0; n < N; n++)
+    {
+        h[n] *= sign;
+    }
 
     for (size_t n = 0; n < N; n++)
     {
-        h[n] = vec->data[n];
-        g[n] = vec->data[N - n];
+        g[n] = h[N - 1 - n];
     }
+}
 
-    gsl_vector_free(vec);
-    
-    *(&wvt->h1) = h;
-    *(&wvt->g1) = g;
-    wvt->h2 = wvt->h1;
-    wvt->g2 = wvt->g1;
 
-    wvt->nc = (N_half << 1);
-    wvt->offset = 0;
+gsl_wavelet* mlx_gauss_wavelet_allocate(const double alpha, size_t N_half)
+{
+    gsl_wavelet *wvt = malloc(sizeof(gsl_wavelet));
+    if (wvt == NULL) return NULL;
+
+    wvt->type = mlx_wavelet_gaussian;
+
+    if (mlx_wavelet_registry_tables(MLX_WVT_GAUSS_FAMILY, alpha, N_half, &wvt->h1, &wvt->g1, &wvt->h2, &wvt->g2, &wvt->nc, &wvt->offset) != GSL_SUCCESS)
+    {
+        free(wvt);
+        return NULL;
+    }
 
     return wvt;
 }
@@ -51,8 +57,8 @@ gsl_wavelet* mlx_gauss_wavelet_allocate(const double alpha, size_t N_half)
 
 void mlx_gauss_wavelet_free(gsl_wavelet* wavelet)
 {
-
-
+    // Coefficients belong to the Registry
+    free(wavelet);
 }
 
 
@@ -61,32 +67,7 @@ gaussian_init (const double **h1, const double **g1,
                           const double **h2, const double **g2, size_t * nc,
                           size_t * offset, size_t member)
 {
-
-    gsl_vector *vec;
-    size_t N = (member << 1);
-    generate_gauss_wavelet(mlx_default_gaussian_wavelet_alpha, N, &vec);
-
-    double *h = calloc(N, sizeof(double));
-    double *g = calloc(N, sizeof(double));
-
-    //memcpy((void*) wvt->g1, &vec->data[0], N * sizeof(double));
-    //memcpy((void*) wvt->h1, &vec->data[N_half], N * sizeof(double));
-
-    for (size_t n = 0; n < N; n++)
-    {
-        h[n] = vec->data[n];
-        g[n] = vec->data[N - n];
-    }
-
-    *h1 = h;
-    *g1 = g;
-    *h2 = h;
-    *g2 = g;
-
-    *nc = N;
-    *offset = 0;
-
-    return GSL_SUCCESS;
+    return mlx_wavelet_registry_tables(MLX_WVT_GAUSS_FAMILY, mlx_default_gaussian_wavelet_alpha, member, h1, g1, h2, g2, nc, offset);
 }
 
 
@@ -96,33 +77,11 @@ gaussian_centered_init (const double **h1, const double **g1,
                           const double **h2, const double **g2, size_t * nc,
                           size_t * offset, size_t member)
 {
+    if (member == 0) return GSL_EINVAL;
 
-    gsl_vector *vec;
-    size_t N = 100; //(member << 1);
-    mlx_default_gaussian_wavelet_alpha = (double) N / member;
-    generate_gauss_wavelet(mlx_default_gaussian_wavelet_alpha, N, &vec);
-
-    double *h = calloc(N, sizeof(double));
-    double *g = calloc(N, sizeof(double));
-
-    //memcpy((void*) wvt->g1, &vec->data[0], N * sizeof(double));
-    //memcpy((void*) wvt->h1, &vec->data[N_half], N * sizeof(double));
-
-    for (size_t n = 0; n < N; n++)
-    {
-        h[n] = -vec->data[n];
-        g[n] = -vec->data[N - n];
-    }
-
-    *h1 = h;
-    *g1 = g;
-    *h2 = h;
-    *g2 = g;
-
-    *nc = N;
-    *offset = N >> 1;
-
-    return GSL_SUCCESS;
+    // alpha is derived per Call, nothing shared is written
+    const double alpha = (double) MLX_WVT_GAUSS_CENTERED_LENGTH / member;
+    return mlx_wavelet_registry_tables(MLX_WVT_GAUSS_CENTERED_FAMILY, alpha, member, h1, g1, h2, g2, nc, offset);
 }
 
 
@@ -149,4 +108,3 @@ Fliegenbeine
 
 Oszilloskope
 */
-
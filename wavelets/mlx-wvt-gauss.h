@@ -28,6 +28,10 @@
 #endif 
 
 
+/* Coefficients of the centered Gauss Wavelet */
+#define MLX_WVT_GAUSS_CENTERED_LENGTH   100
+
+
 /**
  * @brief   Generate Gauss Wavelet as GSL Vector
  * 
@@ -38,7 +42,44 @@
 void generate_gauss_wavelet(const double alpha, size_t N, gsl_vector **out);
 
 
-gsl_wavelet* mlx_gauss_wavelet_allocate(const double alpha, size_t N);
+/**
+ * @brief   Gauss Filter Pair into Caller Buffers (reentrant, no Allocation)
+ * 
+ * @param   alpha  Standard Deviation Parameter
+ * @param   N      Number of Coefficients
+ * @param   sign   Factor applied to all Coefficients (+1 / -1)
+ * @param   h      N Coefficients
+ * @param   g      N Coefficients, h reversed
+ */
+void mlx_gauss_wavelet_coefficients(const double alpha, size_t N, double sign, double *h, double *g);
+
+
+/**
+ * @brief   Gauss Wavelet with 2 N_half Coefficients, Tables are shared (see MlxWaveletRegistry)
+ * 
+ * @return  Wavelet, release with mlx_gauss_wavelet_free
+ */
+gsl_wavelet* mlx_gauss_wavelet_allocate(const double alpha, size_t N_half);
+
+void mlx_gauss_wavelet_free(gsl_wavelet *wavelet);
+
+
+/**
+ * @brief   Coefficient Tables of the Registry (implemented in mlx-wavelet-registry.cc)
+ * 
+ *  The Tables stay valid until the Program ends, so GSL Wavelets allocated with the
+ *  Types below never own (and never leak) their Coefficients.
+ * 
+ * @param   family  WaveletTemplate_t
+ * @return  GSL_SUCCESS or GSL_EINVAL
+ */
+int mlx_wavelet_registry_tables(int family, double alpha, size_t member, const double **h1, const double **g1,
+    const double **h2, const double **g2, size_t *nc, size_t *offset);
+
+
+/* GSL Types, Gauss with alpha = 10.5 and 2 member Coefficients / centered with 100 Coefficients and alpha = 100 / member */
+extern const gsl_wavelet_type *mlx_wavelet_gaussian;
+extern const gsl_wavelet_type *mlx_wavelet_gaussian_centered;
 
 
 #ifdef __cplusplus